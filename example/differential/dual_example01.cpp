@@ -0,0 +1,34 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <numbers>
+
+#include "jr_numeric/differential/derivatives.hpp"
+#include "jr_numeric/differential/dual.hpp"
+#include "jr_numeric/root_finding/roots.hpp"
+
+auto main() -> int {
+  using jr_numeric::differential::derivative;
+  using jr_numeric::differential::evaluateDual;
+  using jr_numeric::differential::partialDerivative;
+  using jr_numeric::roots::newtonRaphson;
+
+  // math functions are called unqualified, so that the Dual overloads are found
+  auto function = [](auto x, auto y) {
+    using std::sin;
+    return sin(x) * y + y * y;
+  };
+
+  auto dfdx = partialDerivative<0>(function, 2 * std::numbers::pi, 2.0);
+  auto dfdy = partialDerivative<1>(function, 2 * std::numbers::pi, 2.0);
+
+  auto gradient = evaluateDual<double>(function, 2 * std::numbers::pi, 2.0);
+
+  fmt::print("f(x, y) = sin(x) * y + y^2 at (2pi, 2)\n");
+  fmt::print("df/dx: {}, df/dy: {}\n", dfdx, dfdy);
+  fmt::print("value: {}, gradient: [{}, {}]\n", gradient.value_, gradient.gradient_[0], gradient.gradient_[1]);
+
+  auto cubic = [](auto x) { return x * x * x - 9; };
+  fmt::print("d/dx (x^3 - 9) at 2: {}\n", derivative(cubic, 2.0));
+  fmt::print("root of x^3 - 9: {}\n", newtonRaphson(cubic, 2.0, 6));
+}
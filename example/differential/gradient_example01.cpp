@@ -0,0 +1,49 @@
+#include <fmt/core.h>
+
+#include <array>
+#include <cmath>
+#include <iostream>
+
+#include "jr_numeric/differential/gradient.hpp"
+
+auto main() -> int {
+  using jr_numeric::differential::gradient;
+  using jr_numeric::differential::hessian;
+  using jr_numeric::differential::jacobian;
+  using jr_numeric::differential::Scheme;
+
+  auto rosenbrock = [](double x, double y) { return (1 - x) * (1 - x) + 100 * (y - x * x) * (y - x * x); };
+
+  // complex step needs a callable generic over the argument type
+  auto rosenbrock_generic = [](auto x, auto y) { return (1. - x) * (1. - x) + 100. * (y - x * x) * (y - x * x); };
+
+  auto x = std::array{-1.2, 1.};
+
+  auto forward = gradient<Scheme::KForward>(rosenbrock, x);
+  auto central = gradient<Scheme::KCentral>(rosenbrock, x);
+  auto complex = gradient<Scheme::KComplexStep>(rosenbrock_generic, x);
+
+  fmt::print("exact: [-215.6, -88]\n");
+  fmt::print("forward: [{}, {}]\n", forward[0], forward[1]);
+  fmt::print("central: [{}, {}]\n", central[0], central[1]);
+  fmt::print("complex step: [{}, {}]\n", complex[0], complex[1]);
+
+  std::cout << "hessian: " << hessian(rosenbrock, x) << '\n';
+
+  // small arguments on top of a large constant, the steps do not shrink below the scale of 1
+  auto offset = [](double a, double b) { return 1e3 + a * a + b; };
+  const auto small = std::array{1e-9, 1e-9};
+  const auto small_forward = gradient<Scheme::KForward>(offset, small);
+  const auto small_central = gradient<Scheme::KCentral>(offset, small);
+  fmt::print(
+      "1e3 + a^2 + b at (1e-9, 1e-9), exact gradient [2e-9, 1], d2/da2 2: forward [{:.3g}, {:.9f}], "
+      "central [{:.3g}, {:.9f}], hessian {:.9f}\n",
+      small_forward[0],
+      small_forward[1],
+      small_central[0],
+      small_central[1],
+      hessian(offset, small)[0][0]);
+
+  auto polar = [](double r, double phi) { return std::array{r * std::cos(phi), r * std::sin(phi)}; };
+  std::cout << "jacobian of polar coordinates: " << jacobian(polar, std::array{2., 0.5}, 2) << '\n';
+}
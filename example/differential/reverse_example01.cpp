@@ -0,0 +1,33 @@
+#include <fmt/core.h>
+
+#include <cmath>
+
+#include "jr_numeric/differential/reverse.hpp"
+
+auto main() -> int {
+  using jr_numeric::differential::reverseGradient;
+  using jr_numeric::differential::Tape;
+
+  // math functions are called unqualified, so that the Var overloads are found
+  auto function = [](auto x, auto y, auto z, auto w) {
+    using std::exp;
+    using std::sqrt;
+    return x * y * z * w + exp(x - w) / sqrt(y * y + z * z);
+  };
+
+  auto tape = Tape<double>();
+
+  for (auto i = 0; i < 3; i++) {
+    auto x = 1. + i;
+    auto [value, gradient] = reverseGradient<double>(tape, function, x, 2., 3., 4.);
+    fmt::print(
+        "f({}, 2, 3, 4) = {}, gradient: [{}, {}, {}, {}], tape nodes: {}\n",
+        x,
+        value,
+        gradient[0],
+        gradient[1],
+        gradient[2],
+        gradient[3],
+        tape.size());
+  }
+}
@@ -0,0 +1,42 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <limits>
+
+#include "jr_numeric/differential/derivatives.hpp"
+
+auto main() -> int {
+  using jr_numeric::differential::derivative;
+  using jr_numeric::differential::richardsonDerivative;
+  using jr_numeric::differential::scaledDerivative;
+
+  auto function = [](double x) { return std::log(x); };
+
+  // log varies on the scale of x itself, so x is its typical scale
+  for (auto x : {1e-6, 1., 1e6}) {
+    auto exact = 1 / x;
+    auto fixed = derivative(function, x);
+    auto scaled = scaledDerivative(function, x, x);
+    auto richardson = richardsonDerivative(function, x, 16 * std::numeric_limits<double>::epsilon(), 0.1, x);
+
+    fmt::print(
+        "x = {:g}: fixed step error {:.1e}, scaled step error {:.1e}, richardson error {:.1e} (estimated {:.1e}, "
+        "{} evaluations)\n",
+        x,
+        std::abs(fixed - exact) / exact,
+        std::abs(scaled - exact) / exact,
+        std::abs(richardson.value_ - exact) / exact,
+        richardson.error_ / exact,
+        richardson.evaluations_);
+  }
+
+  // a small x on top of a large constant, the default typical scale of 1 keeps x + h distinct from x
+  auto offset = [](double x) { return 1e3 + x; };
+  for (auto x : {1e-12, 1e-9, 1e-6}) {
+    fmt::print(
+        "d/dx (1e3 + x) at x = {:g}: scaled {:.9f}, richardson {:.9f}\n",
+        x,
+        scaledDerivative(offset, x),
+        richardsonDerivative(offset, x).value_);
+  }
+}
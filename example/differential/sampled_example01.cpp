@@ -0,0 +1,62 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "jr_numeric/differential/sampled.hpp"
+
+auto main() -> int {
+  using jr_numeric::differential::centralStencil;
+  using jr_numeric::differential::differentiateSamples;
+  using jr_numeric::differential::NonUniformDerivative;
+  using jr_numeric::differential::savitzkyGolay;
+  using jr_numeric::differential::StencilFilter;
+
+  constexpr auto kDt = 0.01;
+  constexpr auto kSamples = 100000;
+
+  auto gen = std::mt19937(42);
+  auto noise = std::normal_distribution<double>(0, 1e-3);
+
+  // angle of a pendulum, streamed sample by sample
+  auto stencil = StencilFilter<double>(centralStencil(2, 1, kDt));
+  auto smoothing = StencilFilter<double>(savitzkyGolay(25, 3, 1, kDt));
+
+  auto stencil_error = 0.;
+  auto smoothing_error = 0.;
+  for (auto i = 0; i < kSamples; i++) {
+    auto theta = 0.2 * std::cos(2 * i * kDt) + noise(gen);
+
+    if (auto d = stencil.push(theta)) {
+      auto t = (i - static_cast<int>(stencil.delay())) * kDt;
+      stencil_error = std::max(stencil_error, std::abs(*d + 0.4 * std::sin(2 * t)));
+    }
+    if (auto d = smoothing.push(theta)) {
+      auto t = (i - static_cast<int>(smoothing.delay())) * kDt;
+      smoothing_error = std::max(smoothing_error, std::abs(*d + 0.4 * std::sin(2 * t)));
+    }
+  }
+
+  fmt::print("max error of angular velocity from noisy samples\n");
+  fmt::print("5 point stencil: {:.3e}, Savitzky-Golay (51 points, cubic): {:.3e}\n", stencil_error, smoothing_error);
+
+  // non uniform sampling
+  auto derivative = NonUniformDerivative<double>(2, 1);
+  auto t = 0.;
+  auto non_uniform_error = 0.;
+  for (auto i = 0; i < 1000; i++) {
+    t += kDt * (1 + 0.5 * std::sin(i));
+    if (auto res = derivative.push(t, std::exp(-t))) {
+      auto [at, d] = *res;
+      non_uniform_error = std::max(non_uniform_error, std::abs(d + std::exp(-at)));
+    }
+  }
+  fmt::print("non uniform grid, derivative of exp(-t): max error {:.3e}\n", non_uniform_error);
+
+  std::vector<double> x = {0, 0.1, 0.3, 0.6, 1.0, 1.5};
+  std::vector<double> y(x.size());
+  for (auto i = 0u; i < x.size(); i++) y[i] = x[i] * x[i] * x[i];
+  auto dy = differentiateSamples<double>(x, y, 1, 4);
+  fmt::print("d/dx x^3 at x = 1.5: {}\n", dy.back());
+}
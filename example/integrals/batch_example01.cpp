@@ -0,0 +1,40 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <functional>
+#include <numbers>
+#include <vector>
+
+#include "jr_numeric/integrals/batch.hpp"
+
+auto main() -> int {
+  using jr_numeric::integrals::gaussNodes;
+  using jr_numeric::integrals::integrateBatch;
+
+  constexpr auto kParams = 10000;
+
+  std::vector<double> params(kParams);
+  for (auto i = 0u; i < params.size(); i++) params[i] = 0.1 + 0.01 * i;
+
+  auto nodes = gaussNodes(0., 1., 4);
+
+  auto results = integrateBatch(nodes, [](double x, double p) { return std::exp(-p * x * x); }, params);
+
+  auto max_error = 0.;
+  for (auto i = 0u; i < params.size(); i++) {
+    auto p = params[i];
+    auto exact = std::sqrt(std::numbers::pi / p) / 2 * std::erf(std::sqrt(p));
+    max_error = std::max(max_error, std::abs(results[i] - exact));
+  }
+
+  fmt::print("{} integrals of exp(-p x^2) on [0, 1], max error: {:.2e}\n", params.size(), max_error);
+
+  std::vector<std::function<double(double)>> family = {
+      [](double x) { return std::sin(x); },
+      [](double x) { return std::cos(x); },
+  };
+
+  auto family_results = integrateBatch(gaussNodes(0., std::numbers::pi), family);
+
+  fmt::print("sin: {}, cos: {}\n", family_results[0], family_results[1]);
+}
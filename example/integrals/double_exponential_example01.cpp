@@ -0,0 +1,35 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include "jr_numeric/integrals/double_exponential.hpp"
+
+auto main() -> int {
+  using jr_numeric::integrals::doubleExponential;
+  using jr_numeric::integrals::Integral;
+
+  constexpr auto kInf = std::numeric_limits<double>::infinity();
+
+  auto singular = Integral<double>{0, 1, [](double x) { return 1 / std::sqrt(x); }};
+  auto logarithm = Integral<double>{0, 1, [](double x) { return std::log(x); }};
+  auto half_line = Integral<double>{0, kInf, [](double x) { return std::exp(-x); }};
+  auto real_line = Integral<double>{-kInf, kInf, [](double x) { return 1 / (1 + x * x); }};
+
+  for (auto const& [name, integral, exact] : {
+           std::tuple{"1/sqrt(x) on [0, 1]", singular, 2.},
+           std::tuple{"log(x) on [0, 1]", logarithm, -1.},
+           std::tuple{"exp(-x) on [0, inf)", half_line, 1.},
+           std::tuple{"1/(1+x^2) on (-inf, inf)", real_line, std::numbers::pi},
+       }) {
+    auto res = doubleExponential<double>(integral);
+    fmt::print(
+        "{}: {} (error: {:.2e}, estimated: {:.2e}, evaluations: {})\n",
+        name,
+        res.value_,
+        std::abs(res.value_ - exact),
+        res.error_estimate_,
+        res.evaluations_);
+  }
+}
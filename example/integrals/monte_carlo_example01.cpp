@@ -0,0 +1,36 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <numbers>
+
+#include "jr_numeric/integrals/monte_carlo.hpp"
+
+auto main() -> int {
+  using jr_numeric::integrals::Hypercube;
+  using jr_numeric::integrals::LowDiscrepancy;
+  using jr_numeric::integrals::MonteCarloOptions;
+  using jr_numeric::integrals::quasiMonteCarlo;
+  using std::numbers::pi;
+
+  // product of normalized sines, the exact integral over the unit hypercube is 1
+  auto function = [](double x0, double x1, double x2, double x3, double x4, double x5, double x6, double x7) {
+    auto f = [](double x) { return pi / 2 * std::sin(pi * x); };
+    return f(x0) * f(x1) * f(x2) * f(x3) * f(x4) * f(x5) * f(x6) * f(x7);
+  };
+
+  auto domain = Hypercube<double, 8>{};
+  domain.high_.fill(1);
+
+  auto sobol = quasiMonteCarlo(function, domain, MonteCarloOptions<double>{.target_error_ = 1e-5});
+  auto halton = quasiMonteCarlo(
+      function, domain, MonteCarloOptions<double>{.sequence_ = LowDiscrepancy::KHalton, .target_error_ = 1e-5});
+
+  fmt::print(
+      "Sobol: {} +- {} ({} evaluations)\nHalton: {} +- {} ({} evaluations)\n",
+      sobol.value_,
+      sobol.std_error_,
+      sobol.evaluations_,
+      halton.value_,
+      halton.std_error_,
+      halton.evaluations_);
+}
@@ -0,0 +1,43 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/integrals/sampled.hpp"
+
+auto main() -> int {
+  using jr_numeric::integrals::cumulativeIntegral;
+  using jr_numeric::integrals::integrateSamples;
+  using jr_numeric::integrals::SampledRule;
+  using jr_numeric::integrals::StreamingIntegral;
+  using std::numbers::pi;
+
+  // non uniform grid on [0, pi], denser at the ends
+  constexpr auto kSamples = 101;
+  std::vector<std::pair<double, double>> samples(kSamples);
+  for (auto i = 0u; i < kSamples; i++) {
+    auto x = pi * (1 - std::cos(pi * i / (kSamples - 1))) / 2;
+    samples[i] = {x, std::sin(x)};
+  }
+
+  fmt::print("trapezoid: {}\n", integrateSamples<double>(samples, SampledRule::KTrapezoid));
+  fmt::print("simpson: {}\n", integrateSamples<double>(samples, SampledRule::KSimpson));
+  fmt::print("spline: {}\n", integrateSamples<double>(samples, SampledRule::KSpline));
+
+  auto cumulative = cumulativeIntegral<double>(samples);
+  auto [x_mid, y_mid] = samples[kSamples / 2];
+  fmt::print("cumulative at x = {}: {} (exact: {})\n", x_mid, cumulative[kSamples / 2], 1 - std::cos(x_mid));
+
+  // uniformly sampled values integrated chunk by chunk
+  constexpr auto kDx = 0.001;
+  auto streaming = StreamingIntegral<double>();
+  std::vector<double> chunk(1000);
+  for (auto c = 0u; c < 5; c++) {
+    for (auto i = 0u; i < chunk.size(); i++) chunk[i] = std::exp(-static_cast<double>(c * chunk.size() + i) * kDx);
+    streaming.push(std::span<const double>(chunk), kDx);
+  }
+  fmt::print("streaming exp(-x) on [0, {}]: {}\n", (streaming.count() - 1) * kDx, streaming.value());
+}
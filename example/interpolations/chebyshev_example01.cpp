@@ -0,0 +1,46 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <numbers>
+
+#include "jr_numeric/interpolations/chebyshev.hpp"
+
+auto main() -> int {
+  using jr_numeric::interpolations::Chebyshev;
+  using std::numbers::pi;
+
+  auto function = [](double x) { return std::exp(x) * std::sin(5 * x); };
+  const auto approximant = Chebyshev<double>::approximate(function, -1., 2.);
+
+  auto max_error = 0.;
+  for (auto i = 0; i <= 1000; i++) {
+    const auto x = -1 + 3e-3 * i;
+    max_error = std::max(max_error, std::abs(approximant(x) - function(x)));
+  }
+  fmt::print("exp(x) sin(5x) on [-1, 2]: degree {}, max error {:.3e}\n", approximant.degree(), max_error);
+
+  const auto derivative = approximant.derivative();
+  const auto exact_derivative = [](double x) { return std::exp(x) * (std::sin(5 * x) + 5 * std::cos(5 * x)); };
+  fmt::print("derivative at 0.5: {:.15f} (exact {:.15f})\n", derivative(0.5), exact_derivative(0.5));
+
+  // exact integral of exp(x) sin(5x) is exp(x) (sin(5x) - 5 cos(5x)) / 26
+  auto primitive = [](double x) { return std::exp(x) * (std::sin(5 * x) - 5 * std::cos(5 * x)) / 26; };
+  fmt::print("integral: {:.15f} (exact {:.15f})\n", approximant.integrate(), primitive(2.) - primitive(-1.));
+  fmt::print(
+      "antiderivative at 1: {:.15f} (exact {:.15f})\n", approximant.integral()(1.), primitive(1.) - primitive(-1.));
+
+  fmt::print("roots, multiples of pi / 5:");
+  for (const auto r : approximant.roots()) fmt::print(" {:.15f}", r * 5 / pi);
+  fmt::print("\n");
+
+  // high degree, the roots are found on subintervals
+  auto bessel = [](double x) { return std::cyl_bessel_j(0., x); };
+  const auto j0 = Chebyshev<double>::approximate(bessel, 0., 100.);
+  const auto roots = j0.roots();
+  fmt::print(
+      "J0 on [0, 100]: degree {}, {} roots, first {:.15f}, last {:.15f}\n",
+      j0.degree(),
+      roots.size(),
+      roots.front(),
+      roots.back());
+}
@@ -0,0 +1,102 @@
+#include <fmt/core.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "jr_numeric/interpolations/grid.hpp"
+#include "jr_numeric/interpolations/rbf.hpp"
+
+auto main() -> int {
+  using jr_numeric::interpolations::GridInterpolation;
+  using jr_numeric::interpolations::GridMethod;
+  using jr_numeric::interpolations::RbfInterpolation;
+  using jr_numeric::interpolations::RbfKernel;
+
+  auto field = [](double x, double y, double z) { return std::sin(x + 2 * y) * std::cos(z) + 0.1 * x * y * z; };
+
+  // 3d lookup table, non uniform along z
+  std::vector<double> xs, ys, zs;
+  for (auto i = 0; i <= 40; i++) xs.push_back(0.05 * i);
+  for (auto i = 0; i <= 30; i++) ys.push_back(0.05 * i);
+  for (auto i = 0; i <= 20; i++) zs.push_back(2. * i * i / 400);
+  std::vector<double> table;
+  for (const auto x : xs) {
+    for (const auto y : ys) {
+      for (const auto z : zs) table.push_back(field(x, y, z));
+    }
+  }
+
+  const auto linear = GridInterpolation<double, 3>({xs, ys, zs}, table);
+  const auto cubic = GridInterpolation<double, 3, GridMethod::KCubic>({xs, ys, zs}, table);
+
+  auto engine = std::mt19937_64{42};
+  auto uniform = std::uniform_real_distribution<double>(0.2, 1.4);
+  std::vector<std::array<double, 3>> queries(200000);
+  for (auto& q : queries) q = {uniform(engine), uniform(engine), uniform(engine)};
+
+  auto measure = [&](auto const& interpolation, char const* name) {
+    auto max_error = 0.;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (const auto& q : queries) {
+      max_error = std::max(max_error, std::abs(interpolation(q) - field(q[0], q[1], q[2])));
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    fmt::print(
+        "{}: max error {:.3e}, {} queries in {} us\n",
+        name,
+        max_error,
+        queries.size(),
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+  };
+  measure(linear, "trilinear");
+  measure(cubic, "tricubic");
+
+  // up to the faces of the grid, where the slopes are one sided, a quadratic is reproduced exactly
+  auto quadratic = [](double x, double y, double z) { return x * x - 3 * y * z + z * z + x; };
+  std::vector<double> quadratic_table;
+  for (const auto x : xs) {
+    for (const auto y : ys) {
+      for (const auto z : zs) quadratic_table.push_back(quadratic(x, y, z));
+    }
+  }
+  const auto cubic_quadratic = GridInterpolation<double, 3, GridMethod::KCubic>({xs, ys, zs}, quadratic_table);
+
+  auto edge_error = 0., quadratic_error = 0.;
+  auto whole = std::uniform_real_distribution<double>(0, 1);
+  for (auto i = 0; i < 200000; i++) {
+    const auto x = 2 * whole(engine), y = 1.5 * whole(engine), z = 2 * whole(engine);
+    edge_error = std::max(edge_error, std::abs(cubic(x, y, z) - field(x, y, z)));
+    quadratic_error = std::max(quadratic_error, std::abs(cubic_quadratic(x, y, z) - quadratic(x, y, z)));
+  }
+  fmt::print("tricubic on the whole grid: max error {:.3e}, quadratic {:.3e}\n", edge_error, quadratic_error);
+
+  // scattered sensors in 2d
+  auto surface = [](double x, double y) { return std::exp(-x * x - y * y) + 0.2 * x; };
+  std::vector<std::array<double, 2>> sensors(20000);
+  std::vector<double> readings(sensors.size());
+  auto square = std::uniform_real_distribution<double>(-2, 2);
+  for (auto i = 0u; i < sensors.size(); i++) {
+    sensors[i] = {square(engine), square(engine)};
+    readings[i] = surface(sensors[i][0], sensors[i][1]);
+  }
+
+  for (const auto kernel : {RbfKernel::KCubic, RbfKernel::KThinPlate}) {
+    const auto rbf = RbfInterpolation<double, 2>(sensors, readings, kernel);
+    auto max_error = 0.;
+    for (auto i = 0; i <= 100; i++) {
+      for (auto j = 0; j <= 100; j++) {
+        const auto x = -1.5 + 0.03 * i, y = -1.5 + 0.03 * j;
+        max_error = std::max(max_error, std::abs(rbf(x, y) - surface(x, y)));
+      }
+    }
+    fmt::print(
+        "rbf {} on {} sensors: max error {:.3e}\n",
+        kernel == RbfKernel::KCubic ? "cubic" : "thin plate",
+        sensors.size(),
+        max_error);
+  }
+}
@@ -1,16 +1,22 @@
+#include <string_view>
+
 #include "jr_numeric/interpolations/lagrange_polynomial.hpp"
 
 using jr_numeric::interpolations::LagrangePolynomial;
 using jr_numeric::interpolations::Method;
 
-inline auto runWithMeasure(LagrangePolynomial const& pol, std::size_t drawing_resolution, Method method) {
+inline auto runWithMeasure(
+    LagrangePolynomial const& pol,
+    std::size_t drawing_resolution,
+    Method method,
+    std::string_view name) {
   auto start = std::chrono::high_resolution_clock::now();
   auto res = generate(pol, drawing_resolution, method);
 
   auto end = std::chrono::high_resolution_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
 
-  fmt::print("Neville: {} us\n", duration.count());
+  fmt::print("{}: {} us\n", name, duration.count());
 
   return res;
 }
@@ -32,6 +38,34 @@ auto main() -> int {
 
   constexpr auto kDrawingResolution = 100;
 
-  auto nev = runWithMeasure(pol, kDrawingResolution, Method::KNeville);
-  auto naive = runWithMeasure(pol, kDrawingResolution, Method::KNaive);
+  auto nev = runWithMeasure(pol, kDrawingResolution, Method::KNeville, "Neville");
+  auto naive = runWithMeasure(pol, kDrawingResolution, Method::KNaive, "Naive");
+  auto barycentric = runWithMeasure(pol, kDrawingResolution, Method::KBarycentric, "Barycentric");
+
+  auto max_difference = 0.;
+  for (auto i = 0u; i < kDrawingResolution; i++) {
+    max_difference = std::max(max_difference, std::abs(naive[i].second - barycentric[i].second));
+  }
+  fmt::print("max |naive - barycentric|: {}\n", max_difference);
+
+  max_difference = 0.;
+  for (auto i = 0u; i < kDrawingResolution; i++) {
+    max_difference = std::max(max_difference, std::abs(nev[i].second - barycentric[i].second));
+  }
+  fmt::print("max |neville - barycentric|: {}\n", max_difference);
+
+  // appending a sample updates the weights in O(n)
+  auto extended = pol;
+  extended.push(samples.back().first + 1, samples.back().second);
+  fmt::print("after push: {} samples, value at the new node {}\n", extended.samples_.size(),
+             extended.barycentric(samples.back().first + 1));
+
+  // built up by pushes alone, starting from no samples
+  auto pushed = LagrangePolynomial(LagrangePolynomial::SamplesVector{});
+  for (const auto& [arg, res] : samples) pushed.push(arg, res);
+  max_difference = 0.;
+  for (const auto& [t, value] : barycentric) {
+    max_difference = std::max(max_difference, std::abs(pushed.barycentric(t) - value));
+  }
+  fmt::print("max |pushed from empty - barycentric|: {}\n", max_difference);
 }
@@ -0,0 +1,34 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <cstdint>
+
+#include "jr_numeric/interpolations/lagrange_polynomial.hpp"
+#include "jr_numeric/interpolations/newton_polynomial.hpp"
+
+auto main() -> int {
+  using jr_numeric::interpolations::LagrangePolynomial;
+  using jr_numeric::interpolations::NewtonPolynomial;
+
+  // the whole table, same polynomial as the Lagrange form
+  auto samples = LagrangePolynomial::SamplesVector{};
+  for (auto i = 0; i < 12; i++) {
+    const auto x = 0.25 * i;
+    samples.emplace_back(x, std::exp(-x) * std::cos(3 * x));
+  }
+  const auto lagrange = LagrangePolynomial(samples);
+  const auto newton = NewtonPolynomial<double>(samples);
+  fmt::print("at 1.1: newton {:.15f}, lagrange {:.15f}\n", newton(1.1), lagrange.barycentric(1.1));
+
+  // a stream of samples, a cubic through the 4 newest ones predicts the next sample
+  auto signal = [](double t) { return std::sin(t) + 0.5 * std::sin(2.3 * t); };
+  constexpr auto kDt = 0.01;
+  auto window = NewtonPolynomial<double>(4);
+  auto max_error = 0.;
+  for (auto i = 0; i < 100000; i++) {
+    const auto t = kDt * i;
+    if (window.size() == 4) max_error = std::max(max_error, std::abs(window(t) - signal(t)));
+    window.push(t, signal(t));
+  }
+  fmt::print("sliding cubic, one step extrapolation over 100000 samples: max error {:.3e}\n", max_error);
+}
@@ -0,0 +1,49 @@
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+
+#include "jr_numeric/interpolations/lagrange_polynomial.hpp"
+#include "jr_numeric/interpolations/sampling.hpp"
+#include "jr_numeric/interpolations/spline.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+auto main() -> int {
+  using jr_numeric::interpolations::chunk;
+  using jr_numeric::interpolations::CubicSpline;
+  using jr_numeric::interpolations::LagrangePolynomial;
+  using jr_numeric::interpolations::Method;
+  using jr_numeric::interpolations::sampled;
+
+  auto samples = LagrangePolynomial::SamplesVector{};
+  for (auto i = 0; i <= 10; i++) samples.emplace_back(0.1 * i, std::sin(3. * i / 10));
+  const auto pol = LagrangePolynomial(samples);
+
+  // nothing is stored, the slice evaluates only the 3 points it shows
+  for (const auto [t, value] : sampled(pol, 1000, Method::KBarycentric) | std::views::drop(500) | std::views::take(3)) {
+    fmt::print("p({:.3f}) = {:.12f}\n", t, value);
+  }
+
+  // 64M points of a spline split between threads, each one reduces its own chunk
+  std::vector<double> x, y;
+  for (auto i = 0; i <= 100; i++) {
+    x.push_back(0.1 * i);
+    y.push_back(std::cos(0.1 * i) * std::exp(-0.01 * i));
+  }
+  const auto spline = CubicSpline<double>(x, y);
+  const auto curve = sampled(spline, 4., 10., std::size_t{1} << 26);
+
+  const auto threads = jr_numeric::utils::hardwareThreads();
+  std::vector<double> maxima(threads);
+  jr_numeric::utils::parallelFor(
+      threads,
+      [&](std::size_t i) {
+        auto part = chunk(curve, threads, i);
+        maxima[i] = std::ranges::max(part | std::views::values);
+      },
+      threads);
+  fmt::print("max over {} points of the spline on [4, 10]: {:.12f}\n", curve.size(), std::ranges::max(maxima));
+}
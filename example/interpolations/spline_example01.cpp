@@ -0,0 +1,81 @@
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/interpolations/spline.hpp"
+
+auto main() -> int {
+  using jr_numeric::interpolations::CubicSpline;
+  using jr_numeric::interpolations::SplineKind;
+
+  auto runge = [](double x) { return 1 / (1 + 25 * x * x); };
+  auto runge_derivative = [](double x) { return -50 * x / ((1 + 25 * x * x) * (1 + 25 * x * x)); };
+
+  constexpr auto kKnots = 41;
+  std::vector<double> x(kKnots), y(kKnots);
+  for (auto i = 0u; i < kKnots; i++) {
+    x[i] = -1 + 2. * i / (kKnots - 1);
+    y[i] = runge(x[i]);
+  }
+
+  auto max_error = [&](CubicSpline<double> const& spline) {
+    auto res = 0.;
+    for (auto i = 0; i <= 10000; i++) {
+      const auto t = -1 + 2e-4 * i;
+      res = std::max(res, std::abs(spline(t) - runge(t)));
+    }
+    return res;
+  };
+
+  const auto ends = std::pair{runge_derivative(-1.), runge_derivative(1.)};
+  const std::pair<std::string_view, SplineKind> kinds[] = {
+      {"natural", SplineKind::KNatural},
+      {"clamped", SplineKind::KClamped},
+      {"not-a-knot", SplineKind::KNotAKnot},
+      {"pchip", SplineKind::KPchip},
+      {"akima", SplineKind::KAkima},
+  };
+  fmt::print("runge function, {} uniform knots\n", kKnots);
+  for (const auto& [name, kind] : kinds) {
+    fmt::print("{:>12}: max error {:.3e}\n", name, max_error(CubicSpline<double>(x, y, kind, ends)));
+  }
+
+  // pchip keeps monotone data monotone, the C2 spline overshoots after the step
+  const std::vector<double> step_x{0, 1, 2, 3, 4, 5};
+  const std::vector<double> step_y{0, 0, 0, 1, 1, 1};
+  const auto natural = CubicSpline<double>(step_x, step_y);
+  const auto pchip = CubicSpline<double>(step_x, step_y, SplineKind::KPchip);
+  fmt::print("step at x = 3.5: natural {:.4f}, pchip {:.4f}\n", natural(3.5), pchip(3.5));
+
+  // a million lookups, O(1) on the uniform grid against binary search on a slightly perturbed one
+  constexpr auto kLarge = 100000;
+  constexpr auto kLookups = 1000000;
+  std::vector<double> large_x(kLarge), large_y(kLarge), perturbed_x(kLarge);
+  for (auto i = 0u; i < kLarge; i++) {
+    large_x[i] = 10. * i / (kLarge - 1);
+    perturbed_x[i] = large_x[i] + (i % 2 == 1 && i + 1 < kLarge ? 1e-6 : 0);
+    large_y[i] = std::sin(large_x[i]);
+  }
+  std::vector<double> t(kLookups), out(kLookups);
+  for (auto i = 0u; i < kLookups; i++) t[i] = 10. * ((i * 7919u) % kLookups) / kLookups;
+
+  for (const auto* knots : {&large_x, &perturbed_x}) {
+    const auto spline = CubicSpline<double>(*knots, large_y);
+    const auto start = std::chrono::high_resolution_clock::now();
+    spline.evaluate(t, out);
+    const auto end = std::chrono::high_resolution_clock::now();
+    fmt::print(
+        "{} knots, uniform {}: {} lookups in {} us, f(1) = {:.12f}\n",
+        kLarge,
+        spline.uniform(),
+        kLookups,
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(),
+        spline(1.));
+  }
+}
@@ -0,0 +1,55 @@
+#include <fmt/core.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+
+#include "jr_numeric/integrals/simpson.hpp"
+#include "jr_numeric/integrals/utils.hpp"
+#include "jr_numeric/interpolations/tabulated.hpp"
+#include "jr_numeric/root_finding/bracketing.hpp"
+#include "jr_numeric/root_finding/roots.hpp"
+
+auto main() -> int {
+  using jr_numeric::integrals::Integral;
+  using jr_numeric::integrals::simpson;
+  using jr_numeric::interpolations::TabulatedFunction;
+  using jr_numeric::interpolations::TabulationOptions;
+  using jr_numeric::roots::bisection;
+  using jr_numeric::roots::brent;
+
+  // stands in for an expensive model, with a kink at 3 that needs small segments
+  auto evaluations = std::size_t{0};
+  auto expensive = [&evaluations](double x) {
+    evaluations++;
+    return std::cyl_bessel_j(0., x) * std::exp(-x / 10) + 0.05 * std::sqrt(std::abs(x - 3));
+  };
+
+  const auto table = TabulatedFunction<double>(expensive, 0., 20., TabulationOptions<double>{1e-10});
+  fmt::print("tabulated with {} evaluations into {} segments\n", evaluations, table.segments());
+
+  // the segment holding the kink stops at max_depth_, the tolerance holds everywhere else
+  auto max_error = 0., kink_error = 0.;
+  for (auto i = 0; i <= 100000; i++) {
+    const auto x = 2e-4 * i;
+    auto& error = std::abs(x - 3) < 1e-3 ? kink_error : max_error;
+    error = std::max(error, std::abs(table(x) - expensive(x)));
+  }
+  fmt::print("max error: {:.3e} away from the kink, {:.3e} next to it\n", max_error, kink_error);
+
+  auto time = [](auto&& run) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    const auto res = run();
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::pair{res, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()};
+  };
+
+  // the table goes wherever an R1RealFunction is expected
+  const auto [direct, direct_us] = time([&] { return simpson(Integral{0., 20., expensive}, 1000000); });
+  const auto [cached, cached_us] = time([&] { return simpson(Integral{0., 20., std::cref(table)}, 1000000); });
+  fmt::print("simpson: direct {:.12f} in {} us, tabulated {:.12f} in {} us\n", direct, direct_us, cached, cached_us);
+
+  fmt::print(
+      "first root: bisection {:.10f}, brent {:.10f}\n", bisection(table, 1., 4., 40), brent(table, 1., 4.).root_);
+}
@@ -0,0 +1,90 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "jr_numeric/ode/batch.hpp"
+#include "jr_numeric/ode/rosenbrock.hpp"
+#include "jr_numeric/ode/runge_kutta.hpp"
+
+auto main() -> int {
+  using jr_numeric::ode::DormandPrince;
+  using jr_numeric::ode::integrateBatch;
+  using jr_numeric::ode::Options;
+  using jr_numeric::ode::Rk4;
+  using jr_numeric::ode::Rosenbrock23;
+  using jr_numeric::ode::Solution;
+  using State = jr_numeric::ode::State<double, 2>;
+
+  // harmonic oscillator, y = (cos t, -sin t)
+  auto oscillator = [](double, State const& y) { return State{y[1], -y[0]}; };
+
+  auto rk4 = Rk4<double, 2>{};
+  auto fixed = rk4.integrate(oscillator, 0., State{1, 0}, 10., 1000);
+  fmt::print("rk4: y(10) = {:.12f}, error = {:.3e}\n", fixed.y_[0], std::abs(fixed.y_[0] - std::cos(10.)));
+
+  // dense output of the adaptive solver, sampled at every integer time the step passes
+  auto dopri = DormandPrince<double, 2>{};
+  auto dense_error = 0.;
+  auto next = 1.;
+  auto observer = [&](double t, State const&) {
+    for (; next <= t; next += 1) {
+      dense_error = std::max(dense_error, std::abs(dopri.denseOutput(next)[0] - std::cos(next)));
+    }
+  };
+  auto adaptive = dopri.integrate(oscillator, 0., State{1, 0}, 10., Options<double>{1e-10, 1e-12}, observer);
+  fmt::print(
+      "dopri5: y(10) = {:.12f}, error = {:.3e}, dense error = {:.3e}, steps = {}, rejected = {}, evaluations = {}\n",
+      adaptive.y_[0],
+      std::abs(adaptive.y_[0] - std::cos(10.)),
+      dense_error,
+      adaptive.statistics_.steps_,
+      adaptive.statistics_.rejected_,
+      adaptive.statistics_.evaluations_);
+
+  // stiff Van der Pol oscillator
+  constexpr auto kMu = 1000.;
+  auto van_der_pol = [](double, State const& y) { return State{y[1], kMu * ((1 - y[0] * y[0]) * y[1]) - y[0]}; };
+
+  auto rosenbrock = Rosenbrock23<double, 2>{};
+  auto stiff = rosenbrock.integrate(van_der_pol, 0., State{2, 0}, 3000., Options<double>{1e-4, 1e-6});
+  fmt::print(
+      "rosenbrock: y(3000) = {:.6f}, steps = {}, rejected = {}, evaluations = {}\n",
+      stiff.y_[0],
+      stiff.statistics_.steps_,
+      stiff.statistics_.rejected_,
+      stiff.statistics_.evaluations_);
+
+  auto explicit_stiff =
+      DormandPrince<double, 2>{}.integrate(van_der_pol, 0., State{2, 0}, 3000., Options<double>{1e-4, 1e-6});
+  fmt::print(
+      "dopri5 on the stiff problem: success = {}, steps = {}\n",
+      explicit_stiff.statistics_.success_,
+      explicit_stiff.statistics_.steps_);
+
+  // y = 2 sqrt(1 - t) ends at t = 1, steps past it give NaN errors and are rejected
+  auto ending = [](double t, State const&) { return State{-1 / std::sqrt(1 - t), 0}; };
+  for (auto [name, nan] :
+       {std::pair{"dopri5", DormandPrince<double, 2>{}.integrate(ending, 0., State{2, 0}, 2.)},
+        std::pair{"rosenbrock", Rosenbrock23<double, 2>{}.integrate(ending, 0., State{2, 0}, 2.)}}) {
+    fmt::print(
+        "{} past a singularity: success = {}, t = {:.6f}, y = {:.6f}\n", name, nan.statistics_.success_, nan.t_,
+        nan.y_[0]);
+  }
+
+  // period of a pendulum for many initial angles
+  auto pendulum = [](double, State const& y) { return State{y[1], -std::sin(y[0])}; };
+
+  constexpr auto kAngles = 64;
+  std::vector<State> initial(kAngles);
+  for (auto i = 0; i < kAngles; i++) initial[i] = State{std::numbers::pi * (i + 1) / (kAngles + 1), 0};
+
+  std::vector<Solution<double, 2>> out(kAngles);
+  integrateBatch<DormandPrince<double, 2>>(pendulum, initial, 0., 2 * std::numbers::pi, out);
+  for (auto i = 0; i < kAngles; i += 16) {
+    fmt::print("pendulum: theta0 = {:.4f}, theta(2 pi) = {:.6f}\n", initial[i][0], out[i].y_[0]);
+  }
+
+  return 0;
+}
@@ -0,0 +1,72 @@
+#include <fmt/core.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include "jr_numeric/optimization/lbfgs.hpp"
+#include "jr_numeric/optimization/line.hpp"
+#include "jr_numeric/optimization/nelder_mead.hpp"
+
+auto main() -> int {
+  using jr_numeric::optimization::brent;
+  using jr_numeric::optimization::goldenSection;
+  using jr_numeric::optimization::Lbfgs;
+  using jr_numeric::optimization::NelderMead;
+  using jr_numeric::optimization::Options;
+
+  auto quartic = [](double x) { return std::cos(x) + x * x * x * x / 20; };
+  const auto golden = goldenSection(quartic, 0., 4.);
+  const auto parabolic = brent(quartic, 0., 4.);
+  fmt::print("golden section: x = {:.10f} in {} evaluations\n", golden.x_, golden.evaluations_);
+  fmt::print("brent:          x = {:.10f} in {} evaluations\n", parabolic.x_, parabolic.evaluations_);
+
+  // generic, so the gradient comes from dual numbers
+  auto rosenbrock = [](auto const& x) {
+    auto res = decltype(x[0] * x[0]){};
+    for (auto i = 0u; i + 1 < x.size(); i++) {
+      const auto a = 1 - x[i];
+      const auto b = x[i + 1] - x[i] * x[i];
+      res += a * a + 100 * b * b;
+    }
+    return res;
+  };
+  // only doubles, the gradient comes from central differences
+  auto rosenbrock2 = [](double x, double y) { return (1 - x) * (1 - x) + 100 * (y - x * x) * (y - x * x); };
+
+  auto lbfgs = Lbfgs<double, 10>{};
+  auto x0 = std::array<double, 10>{};
+  x0.fill(-1.2);
+  const auto dual = lbfgs.minimize(rosenbrock, x0);
+  fmt::print(
+      "l-bfgs, rosenbrock in 10d: f = {:.3e} after {} iterations, {} evaluations, converged {}\n",
+      dual.value_,
+      dual.iterations_,
+      dual.evaluations_,
+      dual.converged_);
+
+  const auto plain = Lbfgs<double, 2>{}.minimize(rosenbrock2, {-1.2, 1.});
+  fmt::print(
+      "l-bfgs, rosenbrock in 2d (differences): x = ({:.8f}, {:.8f}) after {} evaluations\n",
+      plain.x_[0],
+      plain.x_[1],
+      plain.evaluations_);
+
+  // deterministic noise of relative size 1e-6, a gradient based method would stall on it
+  auto noisy = [](std::array<double, 3> const& x) {
+    const auto f = (x[0] - 1) * (x[0] - 1) + 2 * (x[1] + 2) * (x[1] + 2) + 3 * (x[2] - 0.5) * (x[2] - 0.5) + 1;
+    return f * (1 + 1e-6 * std::sin(1e4 * (x[0] + 2 * x[1] + 3 * x[2])));
+  };
+  auto options = Options<double>{};
+  options.x_tolerance_ = 1e-4;
+  options.f_tolerance_ = 1e-5;
+  options.max_evaluations_ = 2000;
+  const auto simplex = NelderMead<double, 3>{}.minimize(noisy, {0., 0., 0.}, options);
+  fmt::print(
+      "nelder-mead, noisy quadratic: x = ({:.4f}, {:.4f}, {:.4f}) after {} evaluations, converged {}\n",
+      simplex.x_[0],
+      simplex.x_[1],
+      simplex.x_[2],
+      simplex.evaluations_,
+      simplex.converged_);
+}
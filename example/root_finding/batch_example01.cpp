@@ -0,0 +1,75 @@
+#include <fmt/core.h>
+
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "jr_numeric/root_finding/batch.hpp"
+#include "jr_numeric/root_finding/bracketing.hpp"
+
+// Kepler's equation E - e sin(E) = M for many orbits
+struct Orbit {
+  double mean_anomaly_;
+  double eccentricity_;
+};
+
+auto main() -> int {
+  using jr_numeric::roots::illinois;
+  using jr_numeric::roots::RootResult;
+  using jr_numeric::roots::solveBatch;
+
+  constexpr auto kCount = 1000000;
+
+  auto gen = std::mt19937(42);
+  auto mean_anomaly = std::uniform_real_distribution<double>(0, 2 * std::numbers::pi);
+  auto eccentricity = std::uniform_real_distribution<double>(0, 0.9);
+
+  std::vector<Orbit> orbits(kCount);
+  std::vector<double> low(kCount), high(kCount);
+  for (auto i = 0; i < kCount; i++) {
+    orbits[i] = Orbit{mean_anomaly(gen), eccentricity(gen)};
+    low[i] = orbits[i].mean_anomaly_ - 1;
+    high[i] = orbits[i].mean_anomaly_ + 1;
+  }
+
+  auto kepler = [](double e, Orbit const& orbit) {
+    return e - orbit.eccentricity_ * std::sin(e) - orbit.mean_anomaly_;
+  };
+
+  std::vector<RootResult<double>> batch(kCount);
+  auto start = std::chrono::steady_clock::now();
+  const auto failures = solveBatch(
+      kepler,
+      std::span<const Orbit>(orbits),
+      std::span<const double>(low),
+      std::span<const double>(high),
+      std::span(batch),
+      {},
+      1);  // one thread, to compare with the loop below
+  const auto batch_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<RootResult<double>> scalar(kCount);
+  start = std::chrono::steady_clock::now();
+  for (auto i = 0; i < kCount; i++) {
+    auto equation = [&kepler, &orbit = orbits[i]](double e) { return kepler(e, orbit); };
+    scalar[i] = illinois(equation, low[i], high[i]);
+  }
+  const auto scalar_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  auto difference = 0.;
+  auto evaluations = 0.;
+  for (auto i = 0; i < kCount; i++) {
+    difference = std::max(difference, std::abs(batch[i].root_ - scalar[i].root_));
+    evaluations += static_cast<double>(batch[i].evaluations_) / kCount;
+  }
+
+  fmt::print(
+      "batch: {:.3f} s, failures = {}, mean evaluations = {:.2f}\nscalar: {:.3f} s\nmax difference = {:.3e}\n",
+      batch_time,
+      failures,
+      evaluations,
+      scalar_time,
+      difference);
+}
@@ -0,0 +1,57 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <string_view>
+
+#include "jr_numeric/root_finding/bracketing.hpp"
+#include "jr_numeric/root_finding/roots.hpp"
+
+auto main() -> int {
+  using jr_numeric::roots::bisection;
+  using jr_numeric::roots::brent;
+  using jr_numeric::roots::illinois;
+  using jr_numeric::roots::itp;
+  using jr_numeric::roots::RootOptions;
+  using jr_numeric::roots::RootResult;
+
+  auto calls = 0;
+  auto function = [&calls](double x) {
+    calls++;
+    return (std::pow(x, 3) - 9) / (std::log(x) - 1);
+  };
+
+  auto print = [](std::string_view name, RootResult<double> const& res) {
+    fmt::print(
+        "{:>9}: root = {:.15f}, f(root) = {:+.3e}, iterations = {:>2}, evaluations = {:>2}, converged = {}\n",
+        name,
+        res.root_,
+        res.value_,
+        res.iterations_,
+        res.evaluations_,
+        res.converged_);
+  };
+
+  print("brent", brent(function, 1.8, 2.1));
+  print("illinois", illinois(function, 1.8, 2.1));
+  print("itp", itp(function, 1.8, 2.1));
+
+  calls = 0;
+  auto approx = bisection<double>(function, 1.8, 2.1, 50);
+  fmt::print("bisection: root = {:.15f}, evaluations = {}\n", approx, calls);
+
+  // looser tolerances stop earlier
+  print("brent", brent(function, 1.8, 2.1, RootOptions<double>{1e-6, 0, 0}));
+  print("brent", brent(function, 1.8, 2.1, RootOptions<double>{0, 0, 1e-3}));
+
+  // a root with a flat neighbourhood
+  auto flat = [](double x) { return std::pow(x - 1, 5); };
+  print("brent", brent(flat, 0., 3.));
+  print("illinois", illinois(flat, 0., 3.));
+  print("itp", itp(flat, 0., 3.));
+
+  // the first step lands on the root, iterations count it like any other exit
+  auto odd = [](double x) { return x * x * x; };
+  print("brent", brent(odd, -1., 1.));
+  print("illinois", illinois(odd, -1., 1.));
+  print("itp", itp(odd, -1., 1.));
+}
@@ -0,0 +1,32 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <numbers>
+
+#include "jr_numeric/root_finding/isolation.hpp"
+
+auto main() -> int {
+  using jr_numeric::roots::findAllRoots;
+  using jr_numeric::roots::IsolationOptions;
+  using jr_numeric::roots::isolateRoots;
+  using std::numbers::pi;
+
+  // Bessel function J0 has a root roughly every pi
+  auto bessel = [](double x) { return std::cyl_bessel_j(0., x); };
+  auto roots = findAllRoots(bessel, 0., 1000.);
+  fmt::print("J0 on [0, 1000]: {} roots, first {:.12f}, last {:.12f}\n", roots.size(), roots.front(), roots.back());
+
+  // two roots 1e-4 apart, far below the sample spacing
+  auto close = [](double x) { return (x - 1.23) * (x - 1.2301) * (x + 3); };
+  roots = findAllRoots(close, -10., 10., IsolationOptions<double>{100});
+  fmt::print("close pair:");
+  for (const auto r : roots) fmt::print(" {:.10f}", r);
+  fmt::print("\n");
+
+  // double roots at multiples of pi can only be recognized with a tolerance on |f|
+  auto tangent = [](double x) { return std::sin(x) * std::sin(x) * (1 + x * x); };
+  auto [brackets, zeros] = isolateRoots(tangent, 1., 10., IsolationOptions<double>{64, 8, 12, 1e-12});
+  fmt::print("tangent: {} brackets, {} double roots:", brackets.size(), zeros.size());
+  for (const auto z : zeros) fmt::print(" {:.6f} (pi multiple {:.6f})", z, z / pi);
+  fmt::print("\n");
+}
@@ -0,0 +1,73 @@
+#include <fmt/core.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+#include "jr_numeric/algebra/vectors.hpp"
+#include "jr_numeric/root_finding/polynomial.hpp"
+
+auto main() -> int {
+  using jr_numeric::algebra::Polynomial;
+  using jr_numeric::roots::polynomialRoots;
+
+  // (x - 1)(x - 2)(x^2 + 1)
+  auto polynomial = Polynomial<5, double>(std::array{2., -3., 3., -3., 1.});
+  for (auto const& root : polynomialRoots(polynomial)) {
+    fmt::print("root: {:+.15f} {:+.15f}i\n", root.real(), root.imag());
+  }
+
+  // Wilkinson's polynomial of degree 20, prod(x - k), ill conditioned: the rounded coefficients move the roots
+  std::vector<double> wilkinson{1};
+  for (auto k = 1; k <= 20; k++) {
+    wilkinson.insert(wilkinson.begin(), 0.);
+    for (auto i = 0u; i + 1 < wilkinson.size(); i++) wilkinson[i] -= k * wilkinson[i + 1];
+  }
+
+  std::vector<std::complex<double>> roots(20);
+  auto report = polynomialRoots(std::span<const double>(wilkinson), std::span(roots));
+  auto worst = 0.;
+  for (auto const& root : roots) worst = std::max(worst, std::abs(root - std::round(root.real())));
+  fmt::print(
+      "wilkinson (aberth-ehrlich): iterations = {}, converged = {}, max error = {:.3e}\n",
+      report.iterations_,
+      report.converged_,
+      worst);
+
+  report = polynomialRoots(std::span<const double>(wilkinson), std::span(roots), 0);
+  worst = 0.;
+  for (auto const& root : roots) worst = std::max(worst, std::abs(root - std::round(root.real())));
+  fmt::print("wilkinson (companion matrix): converged = {}, max error = {:.3e}\n", report.converged_, worst);
+
+  // random polynomials of degree 50
+  auto gen = std::mt19937(42);
+  auto normal = std::normal_distribution<double>();
+  std::vector<double> random(51);
+  for (auto& c : random) c = normal(gen);
+  roots.resize(50);
+  report = polynomialRoots(std::span<const double>(random), std::span(roots));
+  auto residual = 0.;
+  for (auto const& root : roots) {
+    auto p = std::complex<double>{};
+    for (auto i = random.size(); i-- > 0;) p = p * root + random[i];
+    residual = std::max(residual, std::abs(p));
+  }
+  fmt::print("degree 50: iterations = {}, max |p(root)| = {:.3e}\n", report.iterations_, residual);
+
+  // many monic quartics, e.g. characteristic polynomials of 4x4 matrices
+  constexpr auto kCount = 10000;
+  std::vector<Polynomial<5, double>> batch(kCount);
+  for (auto& p : batch) {
+    for (auto i = 0u; i < 4; i++) p.coefficient(i) = normal(gen);
+    p.coefficient(4) = 1;
+  }
+  std::vector<std::array<std::complex<double>, 4>> batch_roots(kCount);
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto failures = polynomialRoots(std::span<const Polynomial<5, double>>(batch), std::span(batch_roots));
+  const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  fmt::print("batch of {}: failures = {}, {:.2f} us per polynomial\n", kCount, failures, elapsed / kCount * 1e6);
+}
@@ -0,0 +1,55 @@
+#include <fmt/core.h>
+
+#include <array>
+#include <cmath>
+#include <string_view>
+
+#include "jr_numeric/root_finding/systems.hpp"
+
+auto main() -> int {
+  using jr_numeric::roots::solveSystem;
+  using jr_numeric::roots::SystemMethod;
+  using jr_numeric::roots::SystemResult;
+
+  // intersection of a circle and a parabola, as a function of 2 arguments
+  auto intersection = [](double x, double y) { return std::array{x * x + y * y - 4, y - x * x + 1}; };
+
+  auto newton = solveSystem(intersection, std::array{1., 1.});
+  fmt::print(
+      "intersection: x = {:.15f}, y = {:.15f}, |F| = {:.3e}, iterations = {}, evaluations = {}\n",
+      newton.x_[0],
+      newton.x_[1],
+      newton.residual_norm_,
+      newton.iterations_,
+      newton.evaluations_);
+
+  // Broyden's tridiagonal problem with 30 unknowns, as a function of an array
+  constexpr auto kN = 30;
+  auto tridiagonal = [](std::array<double, kN> const& x) {
+    std::array<double, kN> f;
+    for (auto i = 0; i < kN; i++) {
+      const auto previous = i > 0 ? x[i - 1] : 0.;
+      const auto next = i + 1 < kN ? x[i + 1] : 0.;
+      f[i] = (3 - 2 * x[i]) * x[i] - previous - 2 * next + 1;
+    }
+    return f;
+  };
+
+  auto print = [](std::string_view name, SystemResult<double, kN> const& res) {
+    fmt::print(
+        "{:>16}: |F| = {:.3e}, iterations = {:>2}, evaluations = {:>3}, jacobians = {}, converged = {}\n",
+        name,
+        res.residual_norm_,
+        res.iterations_,
+        res.evaluations_,
+        res.jacobians_,
+        res.converged_);
+  };
+
+  auto x0 = std::array<double, kN>{};
+  x0.fill(-1);
+
+  print("newton", solveSystem<SystemMethod::KNewton>(tridiagonal, x0, {1e-12, 1e-15, 100, 1}));
+  print("newton (reused)", solveSystem<SystemMethod::KNewton>(tridiagonal, x0, {1e-12}));
+  print("broyden", solveSystem<SystemMethod::KBroyden>(tridiagonal, x0, {1e-12}));
+}
@@ -0,0 +1,46 @@
+#include <fmt/core.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "jr_numeric/statistics/accumulator.hpp"
+#include "jr_numeric/statistics/utils.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+auto main() -> int {
+  using jr_numeric::statistics::Accumulator;
+  using jr_numeric::statistics::setupMeasurement;
+
+  // readings with a large offset, where summing squares would cancel catastrophically
+  constexpr auto kSamples = 1000000;
+  constexpr auto kDevice = 1e-3;
+  auto engine = std::mt19937_64{7};
+  auto noise = std::normal_distribution<double>(1e9, 0.5);
+  std::vector<double> samples(kSamples);
+  for (auto& x : samples) x = noise(engine);
+
+  const auto resident = setupMeasurement(samples, kDevice);
+  fmt::print("whole dataset:  {}\n", resident);
+
+  // every thread summarizes its chunk, the partial results merge into the same moments
+  const auto threads = jr_numeric::utils::hardwareThreads();
+  std::vector<Accumulator<double>> partial(threads);
+  const auto chunks = jr_numeric::utils::parallelChunks(
+      samples.size(), threads, [&](std::size_t id, std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; i++) partial[id].push(samples[i]);
+      });
+  auto merged = Accumulator<double>{};
+  for (auto id = 0u; id < chunks; id++) merged.merge(partial[id]);
+  fmt::print("merged threads: {}\n", setupMeasurement(merged, kDevice));
+
+  // an unbounded stream only keeps three numbers
+  auto stream = Accumulator<double>{};
+  for (auto i = 0; i < 10 * kSamples; i++) stream.push(noise(engine));
+  fmt::print(
+      "stream of {}: mean - 1e9 = {:.3e}, std deviation {:.6f}\n",
+      stream.count_,
+      stream.mean_ - 1e9,
+      std::sqrt(stream.variance()));
+}
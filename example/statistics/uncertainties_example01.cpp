@@ -221,8 +221,9 @@ auto calculateGravity() -> void {
 
     auto l = combineQuantities<ld>([](ld a, ld h, ld d) { return a - h - d; }, a, h, d);
 
-    auto g =
-        combineQuantities<ld>([](ld l, ld t) { return 4 * std::numbers::pi * std::numbers::pi * l / (t * t); }, l, tx1);
+    // generic callable, the gradient comes from a single reverse mode pass
+    auto g = combineQuantities<ld>(
+        [](auto l, auto t) { return 4 * std::numbers::pi * std::numbers::pi * l / (t * t); }, l, tx1);
 
     fmt::print("g_{}: {{ {} }}\n", height_id, g);
   }
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+#include "jr_numeric/algebra/matrix.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::algebra {
+
+/**
+ * @brief PA = LU, L has unit diagonal and both are stored in lu_.
+ */
+template <std::size_t N, FloatingPoint T>
+struct LuFactorization {
+  Matrix<N, N, T> lu_;
+  std::array<std::size_t, N> permutation_{};
+  bool singular_{};
+};
+
+/**
+ * @brief LU factorization with partial pivoting, takes O(N^3) time and no heap memory.
+ */
+template <std::size_t N, FloatingPoint T>
+constexpr auto luFactorize(Matrix<N, N, T> const& matrix) noexcept -> LuFactorization<N, T> {
+  auto res = LuFactorization<N, T>{matrix};
+  auto& lu = res.lu_;
+
+  for (auto i = 0u; i < N; i++) res.permutation_[i] = i;
+
+  for (auto k = 0u; k < N; k++) {
+    auto pivot = k;
+    for (auto i = k + 1; i < N; i++) {
+      if (std::abs(lu[i][k]) > std::abs(lu[pivot][k])) pivot = i;
+    }
+
+    if (lu[pivot][k] == T{}) {
+      res.singular_ = true;
+      continue;
+    }
+
+    if (pivot != k) {
+      std::swap(lu[pivot], lu[k]);
+      std::swap(res.permutation_[pivot], res.permutation_[k]);
+    }
+
+    const auto inv = T{1} / lu[k][k];
+    for (auto i = k + 1; i < N; i++) {
+      const auto factor = lu[i][k] *= inv;
+      if (factor == T{}) continue;
+      for (auto j = k + 1; j < N; j++) lu[i][j] -= factor * lu[k][j];
+    }
+  }
+
+  return res;
+}
+
+/**
+ * @brief solves Ax = rhs for A given by its factorization, takes O(N^2) time
+ */
+template <std::size_t N, FloatingPoint T>
+constexpr auto luSolve(LuFactorization<N, T> const& factorization, std::array<T, N> const& rhs) noexcept
+    -> std::array<T, N> {
+  auto const& lu = factorization.lu_;
+  std::array<T, N> x;
+
+  for (auto i = 0u; i < N; i++) {
+    auto sum = rhs[factorization.permutation_[i]];
+    for (auto j = 0u; j < i; j++) sum -= lu[i][j] * x[j];
+    x[i] = sum;
+  }
+
+  for (auto i = N; i-- > 0;) {
+    auto sum = x[i];
+    for (auto j = i + 1; j < N; j++) sum -= lu[i][j] * x[j];
+    x[i] = sum / lu[i][i];
+  }
+
+  return x;
+}
+
+}  // namespace jr_numeric::algebra
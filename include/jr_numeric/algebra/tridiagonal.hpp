@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::algebra {
+
+/**
+ * @brief Solves a tridiagonal system with the Thomas algorithm in O(n) time, without allocations.
+ *
+ * Row i reads lower[i] * x[i - 1] + diagonal[i] * x[i] + upper[i] * x[i + 1] = rhs[i], lower[0] and upper[n - 1] are
+ * ignored. The system is expected to be diagonally dominant, no pivoting is done.
+ *
+ * @param diagonal overwritten with the eliminated diagonal
+ * @param rhs overwritten with the solution
+ */
+template <concepts::FloatingPoint T>
+auto solveTridiagonal(std::span<const T> lower, std::span<T> diagonal, std::span<const T> upper, std::span<T> rhs)
+    -> void {
+  const auto n = rhs.size();
+  assert(lower.size() == n && diagonal.size() == n && upper.size() == n);
+  if (n == 0) return;
+
+  for (auto i = 1u; i < n; i++) {
+    const auto factor = lower[i] / diagonal[i - 1];
+    diagonal[i] -= factor * upper[i - 1];
+    rhs[i] -= factor * rhs[i - 1];
+  }
+
+  rhs[n - 1] /= diagonal[n - 1];
+  for (auto i = n - 1; i-- > 0;) {
+    rhs[i] = (rhs[i] - upper[i] * rhs[i + 1]) / diagonal[i];
+  }
+}
+
+}  // namespace jr_numeric::algebra
@@ -11,14 +11,30 @@
 
 namespace jr_numeric::algebra {
 
+/**
+ * @brief column vector
+ */
 template <std::size_t N, typename T>
-struct Vector : public Matrix<N, N, T> {
-  using Matrix<N, N, T>::Matrix;
+struct Vector : public Matrix<N, 1, T> {
+  using Matrix<N, 1, T>::Matrix;
+
+  constexpr auto operator()(std::size_t i) const noexcept -> T const& { return (*this)[i][0]; }
+
+  constexpr auto operator()(std::size_t i) noexcept -> T& { return (*this)[i][0]; }
 };
 
+/**
+ * @brief polynomial of degree N - 1, coefficient(i) is the coefficient of x^i
+ */
 template <std::size_t N, concepts::Number T>
 struct Polynomial : Vector<N, T> {
   using Vector<N, T>::Vector;
+
+  constexpr auto coefficient(std::size_t i) const noexcept -> T const& { return (*this)(i); }
+
+  constexpr auto coefficient(std::size_t i) noexcept -> T& { return (*this)(i); }
+
+  static constexpr auto degree() noexcept -> std::size_t { return N - 1; }
 };
 
 }  // namespace jr_numeric::algebra
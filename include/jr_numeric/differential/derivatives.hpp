@@ -1,11 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdlib>
 #include <limits>
 #include <tuple>
 #include <type_traits>
 
+#include "jr_numeric/differential/dual.hpp"
 #include "jr_numeric/utils/concepts.hpp"
 
 namespace jr_numeric::differential {
@@ -20,6 +23,20 @@ consteval auto differentiationEpsilon() -> T {
   return std::sqrt(std::numeric_limits<T>::epsilon());
 }
 
+// step relative to the magnitude of x, but not below base * typical, so that x + h stays distinct from x near 0
+template <concepts::FloatingPoint T>
+auto scaledStep(T x, T base, T typical = 1) noexcept -> T {
+  return base * std::max(std::abs(x), typical);
+}
+
+template <FloatingPoint T, typename Function>
+auto centralDifference(Function const& function, T x, T h) -> T {
+  // make x + h and x - h exactly representable
+  const auto high = x + h;
+  const auto low = x - h;
+  return static_cast<T>(function(high) - function(low)) / (high - low);
+}
+
 }  // namespace implementation
 // N - # of variable to differentiate by in Args
 template <
@@ -60,4 +77,95 @@ auto derivative(Function const& function, T arg) -> std::invoke_result_t<Functio
   return (val_h - val_l) / (2 * kEpsilon);
 }
 
+// exact variants for callables generic over the number type, see Dual
+
+template <
+    std::size_t N,
+    FloatingPoint... Args,
+    FloatingPoint T = std::common_type_t<Args...>,
+    DualScalarField<T, sizeof...(Args), 1> ScalarFieldType>
+auto partialDerivative(ScalarFieldType const& function, Args&&... args) -> T {
+  auto tup = std::make_tuple(Dual<T, 1>(static_cast<T>(args))...);
+  std::get<N>(tup).gradient_[0] = T{1};
+
+  return std::apply(function, tup).gradient_[0];
+}
+
+template <FloatingPoint T, DualR1Function<T> Function>
+auto derivative(Function const& function, T arg) -> T {
+  return function(Dual<T, 1>::variable(arg, 0)).gradient_[0];
+}
+
+template <FloatingPoint T>
+struct DerivativeEstimate {
+  T value_;
+  T error_;
+  std::size_t evaluations_;
+};
+
+/**
+ * @brief Central difference with the step scaled by x, h = cbrt(epsilon) * max(|x|, typical).
+ *
+ * Keeps the relative accuracy the same for x around 1e6, where a fixed absolute step vanishes in its rounding. Below
+ * typical the step stays absolute, because f may vary on a scale unrelated to x, e.g. 1e3 + x at x = 1e-9. A function
+ * that does vary on the scale of x, such as log near 0, should pass a typical of the order of x.
+ */
+template <FloatingPoint T, R1RealFunction Function>
+auto scaledDerivative(Function const& function, T arg, T typical = 1) -> std::invoke_result_t<Function, T> {
+  const auto h = implementation::scaledStep(arg, std::cbrt(std::numeric_limits<T>::epsilon()), typical);
+  return implementation::centralDifference(function, arg, h);
+}
+
+/**
+ * @brief Ridders' method: central differences with decreasing steps, extrapolated in a Richardson tableau.
+ *
+ * Stops as soon as the error estimate drops below tolerance (absolute or relative to the derivative), or when a
+ * new row makes the estimate worse, which means rounding errors took over.
+ *
+ * @param initial_step relative to max(|x|, typical), should be large rather than small
+ * @param typical scale below which the step no longer shrinks with x, as for scaledDerivative
+ */
+template <FloatingPoint T, R1RealFunction Function>
+auto richardsonDerivative(
+    Function const& function,
+    T arg,
+    T tolerance = std::numeric_limits<T>::epsilon() * 16,
+    T initial_step = T{0.1},
+    T typical = 1) -> DerivativeEstimate<T> {
+  constexpr std::size_t kTableau = 10;
+  constexpr auto kShrink = T{1.4};
+  constexpr auto kShrinkSq = kShrink * kShrink;
+  constexpr auto kSafe = T{2};
+
+  std::array<std::array<T, kTableau>, kTableau> a{};
+
+  auto h = implementation::scaledStep(arg, initial_step, typical);
+  a[0][0] = implementation::centralDifference(function, arg, h);
+
+  auto res = DerivativeEstimate<T>{a[0][0], std::numeric_limits<T>::max(), 2};
+
+  for (auto i = 1u; i < kTableau; i++) {
+    h /= kShrink;
+    a[0][i] = implementation::centralDifference(function, arg, h);
+    res.evaluations_ += 2;
+
+    auto factor = kShrinkSq;
+    for (auto j = 1u; j <= i; j++) {
+      a[j][i] = (a[j - 1][i] * factor - a[j - 1][i - 1]) / (factor - 1);
+      factor *= kShrinkSq;
+
+      const auto error = std::max(std::abs(a[j][i] - a[j - 1][i]), std::abs(a[j][i] - a[j - 1][i - 1]));
+      if (error <= res.error_) {
+        res.error_ = error;
+        res.value_ = a[j][i];
+      }
+    }
+
+    if (res.error_ <= tolerance * std::max(T{1}, std::abs(res.value_))) break;
+    if (std::abs(a[i][i] - a[i - 1][i - 1]) >= kSafe * res.error_) break;
+  }
+
+  return res;
+}
+
 }  // namespace jr_numeric::differential
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <numbers>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::differential {
+
+using concepts::FloatingPoint;
+using concepts::Number;
+
+/**
+ * @brief Forward mode automatic differentiation number, carries a value and its gradient wrt N seeded variables.
+ *
+ * Callables meant to be differentiated this way have to be generic over the number type and call math functions
+ * unqualified (after e.g. using std::sin;), so that argument dependent lookup finds the overloads below.
+ */
+template <FloatingPoint T, std::size_t N = 1>
+struct Dual {
+  using Gradient = std::array<T, N>;
+
+  T value_{};
+  Gradient gradient_{};
+
+  constexpr Dual() noexcept = default;
+
+  // NOLINTNEXTLINE(google-explicit-constructor) constants mix freely with duals
+  constexpr Dual(T value) noexcept : value_(value) {}
+
+  constexpr Dual(T value, Gradient const& gradient) noexcept : value_(value), gradient_(gradient) {}
+
+  /**
+   * @brief independent variable number I of N
+   */
+  static constexpr auto variable(T value, std::size_t i) noexcept -> Dual {
+    auto res = Dual(value);
+    res.gradient_[i] = T{1};
+    return res;
+  }
+
+  constexpr auto operator+=(Dual const& rhs) noexcept -> Dual& {
+    value_ += rhs.value_;
+    for (auto i = 0u; i < N; i++) gradient_[i] += rhs.gradient_[i];
+    return *this;
+  }
+
+  constexpr auto operator-=(Dual const& rhs) noexcept -> Dual& {
+    value_ -= rhs.value_;
+    for (auto i = 0u; i < N; i++) gradient_[i] -= rhs.gradient_[i];
+    return *this;
+  }
+
+  constexpr auto operator*=(Dual const& rhs) noexcept -> Dual& {
+    for (auto i = 0u; i < N; i++) gradient_[i] = gradient_[i] * rhs.value_ + value_ * rhs.gradient_[i];
+    value_ *= rhs.value_;
+    return *this;
+  }
+
+  constexpr auto operator/=(Dual const& rhs) noexcept -> Dual& {
+    const auto inv = T{1} / rhs.value_;
+    value_ *= inv;
+    for (auto i = 0u; i < N; i++) gradient_[i] = (gradient_[i] - value_ * rhs.gradient_[i]) * inv;
+    return *this;
+  }
+
+  template <Number U>
+  constexpr auto operator*=(U rhs) noexcept -> Dual& {
+    value_ *= static_cast<T>(rhs);
+    for (auto& g : gradient_) g *= static_cast<T>(rhs);
+    return *this;
+  }
+
+  template <Number U>
+  constexpr auto operator/=(U rhs) noexcept -> Dual& {
+    return *this *= T{1} / static_cast<T>(rhs);
+  }
+
+  constexpr auto operator-() const noexcept -> Dual {
+    auto res = *this;
+    res.value_ = -res.value_;
+    for (auto& g : res.gradient_) g = -g;
+    return res;
+  }
+
+  constexpr auto operator+() const noexcept -> Dual { return *this; }
+};
+
+namespace implementation {
+
+template <typename T>
+constexpr bool kIsDual = false;
+
+template <FloatingPoint T, std::size_t N>
+constexpr bool kIsDual<Dual<T, N>> = true;
+
+// applies the chain rule for an outer function with value f and derivative dfdx
+template <FloatingPoint T, std::size_t N>
+constexpr auto chain(Dual<T, N> const& x, T f, T dfdx) noexcept -> Dual<T, N> {
+  auto res = Dual<T, N>(f);
+  for (auto i = 0u; i < N; i++) res.gradient_[i] = dfdx * x.gradient_[i];
+  return res;
+}
+
+template <std::size_t, typename T>
+using Repeat = T;
+
+template <typename Function, typename Arg, std::size_t... I>
+constexpr auto invocableRepeated(std::index_sequence<I...>) -> bool {
+  return std::is_invocable_v<Function const&, Repeat<I, Arg>...>;
+}
+
+// invocable with sizeof...(I) arguments of type Arg and returning Arg
+template <typename Function, typename Arg, std::size_t... I>
+constexpr auto closedRepeated(std::index_sequence<I...>) -> bool {
+  if constexpr (std::is_invocable_v<Function const&, Repeat<I, Arg>...>) {
+    return std::same_as<std::invoke_result_t<Function const&, Repeat<I, Arg>...>, Arg>;
+  } else {
+    return false;
+  }
+}
+
+}  // namespace implementation
+
+template <typename T>
+concept DualNumber = implementation::kIsDual<std::remove_cvref_t<T>>;
+
+/**
+ * @brief function taking Arity arguments of type Dual<T, Seeds> and returning Dual<T, Seeds>
+ */
+template <typename Function, typename T, std::size_t Arity, std::size_t Seeds = Arity>
+concept DualScalarField =
+    implementation::closedRepeated<Function, Dual<T, Seeds>>(std::make_index_sequence<Arity>{});
+
+template <typename Function, typename T>
+concept DualR1Function = DualScalarField<Function, T, 1>;
+
+template <FloatingPoint T, std::size_t N>
+constexpr auto operator+(Dual<T, N> lhs, Dual<T, N> const& rhs) noexcept -> Dual<T, N> {
+  return lhs += rhs;
+}
+
+template <FloatingPoint T, std::size_t N>
+constexpr auto operator-(Dual<T, N> lhs, Dual<T, N> const& rhs) noexcept -> Dual<T, N> {
+  return lhs -= rhs;
+}
+
+template <FloatingPoint T, std::size_t N>
+constexpr auto operator*(Dual<T, N> lhs, Dual<T, N> const& rhs) noexcept -> Dual<T, N> {
+  return lhs *= rhs;
+}
+
+template <FloatingPoint T, std::size_t N>
+constexpr auto operator/(Dual<T, N> lhs, Dual<T, N> const& rhs) noexcept -> Dual<T, N> {
+  return lhs /= rhs;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator+(Dual<T, N> lhs, U rhs) noexcept -> Dual<T, N> {
+  lhs.value_ += static_cast<T>(rhs);
+  return lhs;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator+(U lhs, Dual<T, N> rhs) noexcept -> Dual<T, N> {
+  return rhs + lhs;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator-(Dual<T, N> lhs, U rhs) noexcept -> Dual<T, N> {
+  lhs.value_ -= static_cast<T>(rhs);
+  return lhs;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator-(U lhs, Dual<T, N> const& rhs) noexcept -> Dual<T, N> {
+  return -rhs + lhs;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator*(Dual<T, N> lhs, U rhs) noexcept -> Dual<T, N> {
+  return lhs *= rhs;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator*(U lhs, Dual<T, N> rhs) noexcept -> Dual<T, N> {
+  return rhs *= lhs;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator/(Dual<T, N> lhs, U rhs) noexcept -> Dual<T, N> {
+  return lhs /= rhs;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator/(U lhs, Dual<T, N> const& rhs) noexcept -> Dual<T, N> {
+  const auto value = static_cast<T>(lhs) / rhs.value_;
+  return implementation::chain(rhs, value, -value / rhs.value_);
+}
+
+template <FloatingPoint T, std::size_t N>
+constexpr auto operator==(Dual<T, N> const& lhs, Dual<T, N> const& rhs) noexcept -> bool {
+  return lhs.value_ == rhs.value_;
+}
+
+template <FloatingPoint T, std::size_t N>
+constexpr auto operator<=>(Dual<T, N> const& lhs, Dual<T, N> const& rhs) noexcept {
+  return lhs.value_ <=> rhs.value_;
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator==(Dual<T, N> const& lhs, U rhs) noexcept -> bool {
+  return lhs.value_ == static_cast<T>(rhs);
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+constexpr auto operator<=>(Dual<T, N> const& lhs, U rhs) noexcept {
+  return lhs.value_ <=> static_cast<T>(rhs);
+}
+
+// math functions, found through ADL
+
+template <FloatingPoint T, std::size_t N>
+auto sin(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::sin(x.value_), std::cos(x.value_));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto cos(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::cos(x.value_), -std::sin(x.value_));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto tan(Dual<T, N> const& x) -> Dual<T, N> {
+  const auto t = std::tan(x.value_);
+  return implementation::chain(x, t, 1 + t * t);
+}
+
+template <FloatingPoint T, std::size_t N>
+auto asin(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::asin(x.value_), 1 / std::sqrt(1 - x.value_ * x.value_));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto acos(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::acos(x.value_), -1 / std::sqrt(1 - x.value_ * x.value_));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto atan(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::atan(x.value_), 1 / (1 + x.value_ * x.value_));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto atan2(Dual<T, N> const& y, Dual<T, N> const& x) -> Dual<T, N> {
+  const auto denom = x.value_ * x.value_ + y.value_ * y.value_;
+  auto res = Dual<T, N>(std::atan2(y.value_, x.value_));
+  for (auto i = 0u; i < N; i++) res.gradient_[i] = (x.value_ * y.gradient_[i] - y.value_ * x.gradient_[i]) / denom;
+  return res;
+}
+
+template <FloatingPoint T, std::size_t N>
+auto sinh(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::sinh(x.value_), std::cosh(x.value_));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto cosh(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::cosh(x.value_), std::sinh(x.value_));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto tanh(Dual<T, N> const& x) -> Dual<T, N> {
+  const auto t = std::tanh(x.value_);
+  return implementation::chain(x, t, 1 - t * t);
+}
+
+template <FloatingPoint T, std::size_t N>
+auto exp(Dual<T, N> const& x) -> Dual<T, N> {
+  const auto e = std::exp(x.value_);
+  return implementation::chain(x, e, e);
+}
+
+template <FloatingPoint T, std::size_t N>
+auto log(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::log(x.value_), 1 / x.value_);
+}
+
+template <FloatingPoint T, std::size_t N>
+auto log10(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(x, std::log10(x.value_), 1 / (x.value_ * std::numbers::ln10_v<T>));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto sqrt(Dual<T, N> const& x) -> Dual<T, N> {
+  const auto s = std::sqrt(x.value_);
+  return implementation::chain(x, s, 1 / (2 * s));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto cbrt(Dual<T, N> const& x) -> Dual<T, N> {
+  const auto c = std::cbrt(x.value_);
+  return implementation::chain(x, c, 1 / (3 * c * c));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto abs(Dual<T, N> const& x) -> Dual<T, N> {
+  return x.value_ < 0 ? -x : x;
+}
+
+template <FloatingPoint T, std::size_t N>
+auto fabs(Dual<T, N> const& x) -> Dual<T, N> {
+  return abs(x);
+}
+
+template <FloatingPoint T, std::size_t N>
+auto erf(Dual<T, N> const& x) -> Dual<T, N> {
+  return implementation::chain(
+      x, std::erf(x.value_), 2 / std::sqrt(std::numbers::pi_v<T>) * std::exp(-x.value_ * x.value_));
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+auto pow(Dual<T, N> const& x, U exponent) -> Dual<T, N> {
+  const auto e = static_cast<T>(exponent);
+  return implementation::chain(x, std::pow(x.value_, e), e * std::pow(x.value_, e - 1));
+}
+
+template <FloatingPoint T, std::size_t N, Number U>
+auto pow(U base, Dual<T, N> const& x) -> Dual<T, N> {
+  const auto b = static_cast<T>(base);
+  const auto p = std::pow(b, x.value_);
+  return implementation::chain(x, p, p * std::log(b));
+}
+
+template <FloatingPoint T, std::size_t N>
+auto pow(Dual<T, N> const& x, Dual<T, N> const& y) -> Dual<T, N> {
+  return exp(y * log(x));
+}
+
+/**
+ * @brief Evaluates function once with every argument seeded as an independent variable.
+ *
+ * @return value of the function together with its gradient
+ */
+template <FloatingPoint T, FloatingPoint... Args, DualScalarField<T, sizeof...(Args)> Function>
+auto evaluateDual(Function const& function, Args... args) -> Dual<T, sizeof...(Args)> {
+  constexpr auto kN = sizeof...(Args);
+  return [&]<std::size_t... I>(std::index_sequence<I...>) {
+    return function(Dual<T, kN>::variable(static_cast<T>(args), I)...);
+  }(std::make_index_sequence<kN>{});
+}
+
+}  // namespace jr_numeric::differential
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "jr_numeric/algebra/matrix.hpp"
+#include "jr_numeric/differential/derivatives.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+namespace jr_numeric::differential {
+
+using concepts::FloatingPoint;
+
+enum class Scheme {
+  KForward,      // N + 1 evaluations, error O(h)
+  KCentral,      // 2N evaluations, error O(h^2)
+  KComplexStep,  // N evaluations with complex arguments, no cancellation, needs a callable generic over the type
+};
+
+namespace implementation {
+
+template <FloatingPoint T>
+auto forwardStep(T x) noexcept -> T {
+  return scaledStep(x, std::sqrt(std::numeric_limits<T>::epsilon()));
+}
+
+template <FloatingPoint T>
+auto centralStep(T x) noexcept -> T {
+  return scaledStep(x, std::cbrt(std::numeric_limits<T>::epsilon()));
+}
+
+template <FloatingPoint T>
+auto hessianStep(T x) noexcept -> T {
+  return scaledStep(x, std::pow(std::numeric_limits<T>::epsilon(), T{0.25}));
+}
+
+template <FloatingPoint T>
+constexpr auto kComplexStep = T{1e-20};
+
+// evaluates function at x with x[i] replaced by x[i] + h, the step is taken exactly representable
+template <FloatingPoint T, std::size_t N, typename Function>
+auto shifted(Function const& function, std::array<T, N> x, std::size_t i, T& h) {
+  const auto moved = x[i] + h;
+  h = moved - x[i];
+  x[i] = moved;
+  return std::apply(function, x);
+}
+
+template <FloatingPoint T, std::size_t N, typename Function>
+auto complexStep(Function const& function, std::array<T, N> const& x, std::size_t i) {
+  std::array<std::complex<T>, N> z;
+  for (auto k = 0u; k < N; k++) z[k] = x[k];
+  z[i] += std::complex<T>(0, kComplexStep<T>);
+  return std::apply(function, z);
+}
+
+}  // namespace implementation
+
+/**
+ * @brief function of N arguments of type Arg
+ */
+template <typename Function, typename Arg, std::size_t N>
+concept InvocableWith = implementation::invocableRepeated<Function, Arg>(std::make_index_sequence<N>{});
+
+/**
+ * @brief Gradient of a scalar field, f(x) is evaluated once and shared by every column of the forward scheme.
+ *
+ * @param threads columns are spread over threads, worth it only for expensive functions
+ */
+template <Scheme S = Scheme::KCentral, FloatingPoint T, std::size_t N, typename Function>
+  requires InvocableWith<Function, T, N> &&
+           (S != Scheme::KComplexStep || InvocableWith<Function, std::complex<T>, N>)
+auto gradient(Function const& function, std::array<T, N> const& x, std::size_t threads = 1) -> std::array<T, N> {
+  std::array<T, N> res{};
+
+  if constexpr (S == Scheme::KComplexStep) {
+    utils::parallelFor(
+        N,
+        [&](std::size_t i) {
+          res[i] = std::imag(implementation::complexStep(function, x, i)) / implementation::kComplexStep<T>;
+        },
+        threads);
+  } else if constexpr (S == Scheme::KForward) {
+    const auto f_x = static_cast<T>(std::apply(function, x));
+    utils::parallelFor(
+        N,
+        [&](std::size_t i) {
+          auto h = implementation::forwardStep(x[i]);
+          const auto f_h = static_cast<T>(implementation::shifted(function, x, i, h));
+          res[i] = (f_h - f_x) / h;
+        },
+        threads);
+  } else {
+    utils::parallelFor(
+        N,
+        [&](std::size_t i) {
+          auto h_high = implementation::centralStep(x[i]);
+          auto h_low = -h_high;
+          const auto f_high = static_cast<T>(implementation::shifted(function, x, i, h_high));
+          const auto f_low = static_cast<T>(implementation::shifted(function, x, i, h_low));
+          res[i] = (f_high - f_low) / (h_high - h_low);
+        },
+        threads);
+  }
+
+  return res;
+}
+
+/**
+ * @brief Jacobian of a vector valued function returning std::array<T, M>, J[i][j] = dF_i / dx_j.
+ */
+template <Scheme S = Scheme::KCentral, FloatingPoint T, std::size_t N, typename Function>
+  requires InvocableWith<Function, T, N> &&
+           (S != Scheme::KComplexStep || InvocableWith<Function, std::complex<T>, N>)
+auto jacobian(Function const& function, std::array<T, N> const& x, std::size_t threads = 1) {
+  using Result = std::remove_cvref_t<decltype(std::apply(function, x))>;
+  constexpr auto kM = std::tuple_size_v<Result>;
+
+  algebra::Matrix<kM, N, T> res;
+
+  auto set_column = [&res](std::size_t j, auto const& column) {
+    for (auto i = 0u; i < kM; i++) res[i][j] = column(i);
+  };
+
+  if constexpr (S == Scheme::KComplexStep) {
+    utils::parallelFor(
+        N,
+        [&](std::size_t j) {
+          const auto f_z = implementation::complexStep(function, x, j);
+          set_column(j, [&](std::size_t i) { return std::imag(f_z[i]) / implementation::kComplexStep<T>; });
+        },
+        threads);
+  } else if constexpr (S == Scheme::KForward) {
+    const auto f_x = std::apply(function, x);
+    utils::parallelFor(
+        N,
+        [&](std::size_t j) {
+          auto h = implementation::forwardStep(x[j]);
+          const auto f_h = implementation::shifted(function, x, j, h);
+          set_column(j, [&](std::size_t i) { return static_cast<T>(f_h[i] - f_x[i]) / h; });
+        },
+        threads);
+  } else {
+    utils::parallelFor(
+        N,
+        [&](std::size_t j) {
+          auto h_high = implementation::centralStep(x[j]);
+          auto h_low = -h_high;
+          const auto f_high = implementation::shifted(function, x, j, h_high);
+          const auto f_low = implementation::shifted(function, x, j, h_low);
+          set_column(j, [&](std::size_t i) { return static_cast<T>(f_high[i] - f_low[i]) / (h_high - h_low); });
+        },
+        threads);
+  }
+
+  return res;
+}
+
+/**
+ * @brief Hessian of a scalar field from 1 + 2N + 2N(N - 1) evaluations.
+ *
+ * Both the diagonal and the mixed terms are central differences, O(h^2) accurate, with f(x) evaluated once. The
+ * points x +- h are taken exactly representable, the mixed term is (f(++) - f(+-) - f(-+) + f(--)) divided by the
+ * actual widths of both steps and the diagonal accounts for the forward and backward steps differing.
+ */
+template <FloatingPoint T, std::size_t N, typename Function>
+  requires InvocableWith<Function, T, N>
+auto hessian(Function const& function, std::array<T, N> const& x, std::size_t threads = 1) -> algebra::Matrix<N, N, T> {
+  algebra::Matrix<N, N, T> res;
+
+  std::array<T, N> high, low;
+  const auto f_x = static_cast<T>(std::apply(function, x));
+
+  utils::parallelFor(
+      N,
+      [&](std::size_t i) {
+        auto h_high = implementation::hessianStep(x[i]);
+        auto h_low = -h_high;
+        const auto f_forward = static_cast<T>(implementation::shifted(function, x, i, h_high));
+        const auto f_backward = static_cast<T>(implementation::shifted(function, x, i, h_low));
+        high[i] = x[i] + h_high;
+        low[i] = x[i] + h_low;
+
+        const auto width = h_high - h_low;
+        res[i][i] = 2 * (f_forward * -h_low + f_backward * h_high - f_x * width) / (h_high * -h_low * width);
+      },
+      threads);
+
+  utils::parallelFor(
+      N,
+      [&](std::size_t i) {
+        for (auto j = i + 1; j < N; j++) {
+          auto corner = [&](T xi, T xj) {
+            auto moved = x;
+            moved[i] = xi;
+            moved[j] = xj;
+            return static_cast<T>(std::apply(function, moved));
+          };
+          res[i][j] = (corner(high[i], high[j]) - corner(high[i], low[j]) - corner(low[i], high[j]) +
+                       corner(low[i], low[j])) /
+                      ((high[i] - low[i]) * (high[j] - low[j]));
+          res[j][i] = res[i][j];
+        }
+      },
+      threads);
+
+  return res;
+}
+
+}  // namespace jr_numeric::differential
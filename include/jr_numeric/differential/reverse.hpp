@@ -0,0 +1,405 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/differential/dual.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::differential {
+
+using concepts::FloatingPoint;
+using concepts::Number;
+
+template <FloatingPoint T>
+class Tape;
+
+/**
+ * @brief Reverse mode automatic differentiation variable, a value together with its node on a Tape.
+ *
+ * Variables without a tape are constants. As with Dual, callables have to be generic over the number type and call
+ * math functions unqualified.
+ */
+template <FloatingPoint T>
+struct Var {
+  T value_{};
+  std::uint32_t index_{};
+  Tape<T>* tape_{};
+
+  constexpr Var() noexcept = default;
+
+  // NOLINTNEXTLINE(google-explicit-constructor) constants mix freely with variables
+  constexpr Var(T value) noexcept : value_(value) {}
+
+  constexpr Var(T value, std::uint32_t index, Tape<T>* tape) noexcept : value_(value), index_(index), tape_(tape) {}
+
+  auto operator+=(Var const& rhs) -> Var&;
+  auto operator-=(Var const& rhs) -> Var&;
+  auto operator*=(Var const& rhs) -> Var&;
+  auto operator/=(Var const& rhs) -> Var&;
+};
+
+/**
+ * @brief Arena of the operations recorded by Var.
+ *
+ * Every node keeps at most two parents with the local partial derivatives. reset() only rewinds the arena, the memory
+ * is kept for the next evaluation, so a tape reused in a loop stops allocating after the first pass.
+ */
+template <FloatingPoint T>
+class Tape {
+ public:
+  struct Node {
+    std::array<std::uint32_t, 2> parents_;
+    std::array<T, 2> partials_;
+  };
+
+ private:
+  std::vector<Node> nodes_;
+  std::vector<T> adjoints_;
+
+ public:
+  explicit Tape(std::size_t capacity = 1024) {
+    nodes_.reserve(capacity);
+    adjoints_.reserve(capacity);
+  }
+
+  auto reset() noexcept -> void { nodes_.clear(); }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return nodes_.size(); }
+
+  auto record(T value, Node const& node) -> Var<T> {
+    nodes_.push_back(node);
+    return Var<T>(value, static_cast<std::uint32_t>(nodes_.size() - 1), this);
+  }
+
+  auto variable(T value) -> Var<T> { return record(value, Node{}); }
+
+  /**
+   * @brief Backward pass from output.
+   *
+   * @return adjoints of every node recorded before output, the adjoint of a variable is adjoints[variable.index_].
+   * The span is invalidated by the next call.
+   */
+  auto adjoints(Var<T> const& output) -> std::span<const T> {
+    if (output.tape_ == nullptr) {
+      adjoints_.assign(nodes_.size(), T{});
+      return adjoints_;
+    }
+    assert(output.tape_ == this);
+
+    adjoints_.assign(nodes_.size(), T{});
+    adjoints_[output.index_] = T{1};
+
+    for (auto i = static_cast<std::size_t>(output.index_) + 1; i-- > 0;) {
+      const auto adjoint = adjoints_[i];
+      if (adjoint == 0) continue;
+      auto const& [parents, partials] = nodes_[i];
+      adjoints_[parents[0]] += partials[0] * adjoint;
+      adjoints_[parents[1]] += partials[1] * adjoint;
+    }
+
+    return adjoints_;
+  }
+};
+
+namespace implementation {
+
+template <FloatingPoint T>
+auto unary(Var<T> const& x, T value, T partial) -> Var<T> {
+  if (x.tape_ == nullptr) return Var<T>(value);
+  return x.tape_->record(value, {{x.index_, 0}, {partial, T{}}});
+}
+
+template <FloatingPoint T>
+auto binary(Var<T> const& lhs, Var<T> const& rhs, T value, T partial_lhs, T partial_rhs) -> Var<T> {
+  if (lhs.tape_ == nullptr) return unary(rhs, value, partial_rhs);
+  if (rhs.tape_ == nullptr) return unary(lhs, value, partial_lhs);
+  assert(lhs.tape_ == rhs.tape_);
+  return lhs.tape_->record(value, {{lhs.index_, rhs.index_}, {partial_lhs, partial_rhs}});
+}
+
+template <FloatingPoint T>
+auto defaultTape() -> Tape<T>& {
+  thread_local Tape<T> tape;
+  return tape;
+}
+
+}  // namespace implementation
+
+/**
+ * @brief function taking Arity arguments of type Var<T> and returning Var<T>
+ */
+template <typename Function, typename T, std::size_t Arity>
+concept ReverseScalarField = implementation::closedRepeated<Function, Var<T>>(std::make_index_sequence<Arity>{});
+
+template <FloatingPoint T>
+auto operator+(Var<T> const& lhs, Var<T> const& rhs) -> Var<T> {
+  return implementation::binary(lhs, rhs, lhs.value_ + rhs.value_, T{1}, T{1});
+}
+
+template <FloatingPoint T>
+auto operator-(Var<T> const& lhs, Var<T> const& rhs) -> Var<T> {
+  return implementation::binary(lhs, rhs, lhs.value_ - rhs.value_, T{1}, T{-1});
+}
+
+template <FloatingPoint T>
+auto operator*(Var<T> const& lhs, Var<T> const& rhs) -> Var<T> {
+  return implementation::binary(lhs, rhs, lhs.value_ * rhs.value_, rhs.value_, lhs.value_);
+}
+
+template <FloatingPoint T>
+auto operator/(Var<T> const& lhs, Var<T> const& rhs) -> Var<T> {
+  const auto value = lhs.value_ / rhs.value_;
+  return implementation::binary(lhs, rhs, value, T{1} / rhs.value_, -value / rhs.value_);
+}
+
+template <FloatingPoint T>
+auto operator-(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, -x.value_, T{-1});
+}
+
+template <FloatingPoint T>
+auto operator+(Var<T> const& x) -> Var<T> {
+  return x;
+}
+
+template <FloatingPoint T, Number U>
+auto operator+(Var<T> const& lhs, U rhs) -> Var<T> {
+  return lhs + Var<T>(static_cast<T>(rhs));
+}
+
+template <FloatingPoint T, Number U>
+auto operator+(U lhs, Var<T> const& rhs) -> Var<T> {
+  return Var<T>(static_cast<T>(lhs)) + rhs;
+}
+
+template <FloatingPoint T, Number U>
+auto operator-(Var<T> const& lhs, U rhs) -> Var<T> {
+  return lhs - Var<T>(static_cast<T>(rhs));
+}
+
+template <FloatingPoint T, Number U>
+auto operator-(U lhs, Var<T> const& rhs) -> Var<T> {
+  return Var<T>(static_cast<T>(lhs)) - rhs;
+}
+
+template <FloatingPoint T, Number U>
+auto operator*(Var<T> const& lhs, U rhs) -> Var<T> {
+  return lhs * Var<T>(static_cast<T>(rhs));
+}
+
+template <FloatingPoint T, Number U>
+auto operator*(U lhs, Var<T> const& rhs) -> Var<T> {
+  return Var<T>(static_cast<T>(lhs)) * rhs;
+}
+
+template <FloatingPoint T, Number U>
+auto operator/(Var<T> const& lhs, U rhs) -> Var<T> {
+  return lhs / Var<T>(static_cast<T>(rhs));
+}
+
+template <FloatingPoint T, Number U>
+auto operator/(U lhs, Var<T> const& rhs) -> Var<T> {
+  return Var<T>(static_cast<T>(lhs)) / rhs;
+}
+
+template <FloatingPoint T>
+auto Var<T>::operator+=(Var const& rhs) -> Var& {
+  return *this = *this + rhs;
+}
+
+template <FloatingPoint T>
+auto Var<T>::operator-=(Var const& rhs) -> Var& {
+  return *this = *this - rhs;
+}
+
+template <FloatingPoint T>
+auto Var<T>::operator*=(Var const& rhs) -> Var& {
+  return *this = *this * rhs;
+}
+
+template <FloatingPoint T>
+auto Var<T>::operator/=(Var const& rhs) -> Var& {
+  return *this = *this / rhs;
+}
+
+template <FloatingPoint T>
+constexpr auto operator==(Var<T> const& lhs, Var<T> const& rhs) noexcept -> bool {
+  return lhs.value_ == rhs.value_;
+}
+
+template <FloatingPoint T>
+constexpr auto operator<=>(Var<T> const& lhs, Var<T> const& rhs) noexcept {
+  return lhs.value_ <=> rhs.value_;
+}
+
+template <FloatingPoint T, Number U>
+constexpr auto operator==(Var<T> const& lhs, U rhs) noexcept -> bool {
+  return lhs.value_ == static_cast<T>(rhs);
+}
+
+template <FloatingPoint T, Number U>
+constexpr auto operator<=>(Var<T> const& lhs, U rhs) noexcept {
+  return lhs.value_ <=> static_cast<T>(rhs);
+}
+
+// math functions, found through ADL
+
+template <FloatingPoint T>
+auto sin(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::sin(x.value_), std::cos(x.value_));
+}
+
+template <FloatingPoint T>
+auto cos(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::cos(x.value_), -std::sin(x.value_));
+}
+
+template <FloatingPoint T>
+auto tan(Var<T> const& x) -> Var<T> {
+  const auto t = std::tan(x.value_);
+  return implementation::unary(x, t, 1 + t * t);
+}
+
+template <FloatingPoint T>
+auto asin(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::asin(x.value_), 1 / std::sqrt(1 - x.value_ * x.value_));
+}
+
+template <FloatingPoint T>
+auto acos(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::acos(x.value_), -1 / std::sqrt(1 - x.value_ * x.value_));
+}
+
+template <FloatingPoint T>
+auto atan(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::atan(x.value_), 1 / (1 + x.value_ * x.value_));
+}
+
+template <FloatingPoint T>
+auto atan2(Var<T> const& y, Var<T> const& x) -> Var<T> {
+  const auto denom = x.value_ * x.value_ + y.value_ * y.value_;
+  return implementation::binary(y, x, std::atan2(y.value_, x.value_), x.value_ / denom, -y.value_ / denom);
+}
+
+template <FloatingPoint T>
+auto sinh(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::sinh(x.value_), std::cosh(x.value_));
+}
+
+template <FloatingPoint T>
+auto cosh(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::cosh(x.value_), std::sinh(x.value_));
+}
+
+template <FloatingPoint T>
+auto tanh(Var<T> const& x) -> Var<T> {
+  const auto t = std::tanh(x.value_);
+  return implementation::unary(x, t, 1 - t * t);
+}
+
+template <FloatingPoint T>
+auto exp(Var<T> const& x) -> Var<T> {
+  const auto e = std::exp(x.value_);
+  return implementation::unary(x, e, e);
+}
+
+template <FloatingPoint T>
+auto log(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::log(x.value_), 1 / x.value_);
+}
+
+template <FloatingPoint T>
+auto log10(Var<T> const& x) -> Var<T> {
+  return implementation::unary(x, std::log10(x.value_), 1 / (x.value_ * std::numbers::ln10_v<T>));
+}
+
+template <FloatingPoint T>
+auto sqrt(Var<T> const& x) -> Var<T> {
+  const auto s = std::sqrt(x.value_);
+  return implementation::unary(x, s, 1 / (2 * s));
+}
+
+template <FloatingPoint T>
+auto cbrt(Var<T> const& x) -> Var<T> {
+  const auto c = std::cbrt(x.value_);
+  return implementation::unary(x, c, 1 / (3 * c * c));
+}
+
+template <FloatingPoint T>
+auto abs(Var<T> const& x) -> Var<T> {
+  return x.value_ < 0 ? -x : x;
+}
+
+template <FloatingPoint T>
+auto fabs(Var<T> const& x) -> Var<T> {
+  return abs(x);
+}
+
+template <FloatingPoint T>
+auto erf(Var<T> const& x) -> Var<T> {
+  return implementation::unary(
+      x, std::erf(x.value_), 2 / std::sqrt(std::numbers::pi_v<T>) * std::exp(-x.value_ * x.value_));
+}
+
+template <FloatingPoint T, Number U>
+auto pow(Var<T> const& x, U exponent) -> Var<T> {
+  const auto e = static_cast<T>(exponent);
+  return implementation::unary(x, std::pow(x.value_, e), e * std::pow(x.value_, e - 1));
+}
+
+template <FloatingPoint T, Number U>
+auto pow(U base, Var<T> const& x) -> Var<T> {
+  const auto b = static_cast<T>(base);
+  const auto p = std::pow(b, x.value_);
+  return implementation::unary(x, p, p * std::log(b));
+}
+
+template <FloatingPoint T>
+auto pow(Var<T> const& x, Var<T> const& y) -> Var<T> {
+  const auto p = std::pow(x.value_, y.value_);
+  return implementation::binary(x, y, p, y.value_ * std::pow(x.value_, y.value_ - 1), p * std::log(x.value_));
+}
+
+template <FloatingPoint T, std::size_t N>
+struct ValueAndGradient {
+  T value_;
+  std::array<T, N> gradient_;
+};
+
+/**
+ * @brief One forward and one backward pass over tape, whatever the number of arguments.
+ *
+ * The tape is reset before recording, so its memory is reused between calls.
+ */
+template <FloatingPoint T, FloatingPoint... Args, ReverseScalarField<T, sizeof...(Args)> Function>
+auto reverseGradient(Tape<T>& tape, Function const& function, Args... args) -> ValueAndGradient<T, sizeof...(Args)> {
+  constexpr auto kN = sizeof...(Args);
+  tape.reset();
+
+  std::array<Var<T>, kN> inputs{tape.variable(static_cast<T>(args))...};
+  auto output = std::apply(function, inputs);
+
+  auto adjoints = tape.adjoints(output);
+
+  auto res = ValueAndGradient<T, kN>{output.value_, {}};
+  for (auto i = 0u; i < kN; i++) res.gradient_[i] = adjoints[inputs[i].index_];
+  return res;
+}
+
+/**
+ * @brief uses a thread local tape
+ */
+template <FloatingPoint T, FloatingPoint... Args, ReverseScalarField<T, sizeof...(Args)> Function>
+auto reverseGradient(Function const& function, Args... args) -> ValueAndGradient<T, sizeof...(Args)> {
+  return reverseGradient<T>(implementation::defaultTape<T>(), function, args...);
+}
+
+}  // namespace jr_numeric::differential
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::differential {
+
+using concepts::FloatingPoint;
+
+namespace implementation {
+
+/**
+ * @brief Fornberg's algorithm, weights of the derivatives up to order at z from samples at grid.
+ *
+ * @param table scratch of grid.size() x (order + 1), weights of derivative k for grid[j] end up in table[j][k]
+ */
+template <FloatingPoint T>
+auto fornberg(T z, std::span<const T> grid, std::size_t order, std::vector<T>& table) -> void {
+  const auto n = grid.size();
+  const auto stride = order + 1;
+  table.assign(n * stride, T{});
+  auto c = [&table, stride](std::size_t j, std::size_t k) -> T& { return table[j * stride + k]; };
+
+  auto c1 = T{1};
+  auto c4 = grid[0] - z;
+  c(0, 0) = 1;
+
+  for (auto i = 1u; i < n; i++) {
+    const auto mn = std::min<std::size_t>(i, order);
+    auto c2 = T{1};
+    const auto c5 = c4;
+    c4 = grid[i] - z;
+
+    for (auto j = 0u; j < i; j++) {
+      const auto c3 = grid[i] - grid[j];
+      c2 *= c3;
+      if (j == i - 1) {
+        for (auto k = mn; k > 0; k--) c(i, k) = c1 * (k * c(i - 1, k - 1) - c5 * c(i - 1, k)) / c2;
+        c(i, 0) = -c1 * c5 * c(i - 1, 0) / c2;
+      }
+      for (auto k = mn; k > 0; k--) c(j, k) = (c4 * c(j, k) - k * c(j, k - 1)) / c3;
+      c(j, 0) = c4 * c(j, 0) / c3;
+    }
+    c1 = c2;
+  }
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Weights w such that sum(w[j] * f(grid[j])) approximates the derivative of the given order at z.
+ */
+template <FloatingPoint T>
+auto finiteDifferenceWeights(T z, std::span<const T> grid, std::size_t order) -> std::vector<T> {
+  assert(grid.size() > order);
+  std::vector<T> table;
+  implementation::fornberg(z, grid, order, table);
+
+  std::vector<T> weights(grid.size());
+  for (auto j = 0u; j < grid.size(); j++) weights[j] = table[j * (order + 1) + order];
+  return weights;
+}
+
+/**
+ * @brief Central stencil of 2 * half + 1 points on a uniform grid with spacing dx.
+ */
+template <FloatingPoint T>
+auto centralStencil(std::size_t half, std::size_t order, T dx) -> std::vector<T> {
+  std::vector<T> grid(2 * half + 1);
+  for (auto j = 0u; j < grid.size(); j++) grid[j] = (static_cast<T>(j) - static_cast<T>(half)) * dx;
+  return finiteDifferenceWeights<T>(T{}, grid, order);
+}
+
+/**
+ * @brief Savitzky-Golay coefficients: least squares polynomial of polynomial_order fitted to 2 * half + 1 uniformly
+ * spaced samples, differentiated order times at the central sample.
+ */
+template <FloatingPoint T>
+auto savitzkyGolay(std::size_t half, std::size_t polynomial_order, std::size_t order, T dx) -> std::vector<T> {
+  const auto window = 2 * half + 1;
+  const auto terms = polynomial_order + 1;
+  assert(polynomial_order < window);
+  assert(order <= polynomial_order);
+
+  // augmented system [A^T A | A^T], A[k][i] = offset_k^i
+  const auto cols = terms + window;
+  std::vector<T> system(terms * cols, T{});
+  auto at = [&system, cols](std::size_t r, std::size_t c) -> T& { return system[r * cols + c]; };
+
+  for (auto k = 0u; k < window; k++) {
+    const auto offset = static_cast<T>(k) - static_cast<T>(half);
+    auto power_r = T{1};
+    for (auto r = 0u; r < terms; r++, power_r *= offset) {
+      auto power_c = T{1};
+      for (auto c = 0u; c < terms; c++, power_c *= offset) at(r, c) += power_r * power_c;
+      at(r, terms + k) = power_r;
+    }
+  }
+
+  // Gauss-Jordan with partial pivoting
+  for (auto p = 0u; p < terms; p++) {
+    auto pivot = p;
+    for (auto r = p + 1; r < terms; r++) {
+      if (std::abs(at(r, p)) > std::abs(at(pivot, p))) pivot = r;
+    }
+    for (auto c = 0u; c < cols; c++) std::swap(at(p, c), at(pivot, c));
+
+    const auto inv = T{1} / at(p, p);
+    for (auto c = 0u; c < cols; c++) at(p, c) *= inv;
+
+    for (auto r = 0u; r < terms; r++) {
+      if (r == p || at(r, p) == 0) continue;
+      const auto factor = at(r, p);
+      for (auto c = 0u; c < cols; c++) at(r, c) -= factor * at(p, c);
+    }
+  }
+
+  auto factorial = T{1};
+  for (auto i = 2u; i <= order; i++) factorial *= static_cast<T>(i);
+  const auto scale = factorial / std::pow(dx, static_cast<T>(order));
+
+  std::vector<T> coefficients(window);
+  for (auto k = 0u; k < window; k++) coefficients[k] = at(order, terms + k) * scale;
+  return coefficients;
+}
+
+/**
+ * @brief Streaming convolution of a uniformly sampled signal with a centered stencil.
+ *
+ * Keeps only the last window samples in a ring buffer. Every sample is stored twice, so that the window is always
+ * contiguous. The output for a sample is available half = window / 2 samples later; the first and last half samples
+ * of the stream have no output.
+ */
+template <FloatingPoint T>
+class StencilFilter {
+  std::vector<T> coefficients_;
+  std::vector<T> buffer_;
+  std::size_t position_{};
+  std::size_t count_{};
+
+ public:
+  explicit StencilFilter(std::vector<T> coefficients)
+      : coefficients_(std::move(coefficients)), buffer_(2 * coefficients_.size()) {
+    assert(coefficients_.size() % 2 == 1);
+  }
+
+  [[nodiscard]] auto window() const noexcept -> std::size_t { return coefficients_.size(); }
+
+  [[nodiscard]] auto delay() const noexcept -> std::size_t { return coefficients_.size() / 2; }
+
+  auto reset() noexcept -> void { position_ = count_ = 0; }
+
+  /**
+   * @return filtered value of the sample pushed delay() samples ago, once the window is full
+   */
+  auto push(T y) noexcept -> std::optional<T> {
+    const auto w = window();
+    buffer_[position_] = y;
+    buffer_[position_ + w] = y;
+    position_ = (position_ + 1) % w;
+    count_++;
+
+    if (count_ < w) return std::nullopt;
+
+    // oldest sample is at position_
+    return std::inner_product(coefficients_.begin(), coefficients_.end(), buffer_.begin() + position_, T{});
+  }
+
+  /**
+   * @brief pushes a chunk, writes the produced values to out and returns how many were written
+   */
+  auto push(std::span<const T> chunk, std::span<T> out) noexcept -> std::size_t {
+    auto written = std::size_t{0};
+    for (const auto y : chunk) {
+      if (auto res = push(y)) {
+        assert(written < out.size());
+        out[written++] = *res;
+      }
+    }
+    return written;
+  }
+};
+
+/**
+ * @brief Streaming derivative of a non uniformly sampled signal, Fornberg weights recomputed for every window.
+ *
+ * O(window) state, O(window^2) work per sample.
+ */
+template <FloatingPoint T>
+class NonUniformDerivative {
+  std::size_t window_;
+  std::size_t order_;
+  std::vector<T> x_;  // doubled ring buffers, see StencilFilter
+  std::vector<T> y_;
+  std::vector<T> table_;
+  std::size_t position_{};
+  std::size_t count_{};
+
+ public:
+  NonUniformDerivative(std::size_t half, std::size_t order)
+      : window_(2 * half + 1), order_(order), x_(2 * window_), y_(2 * window_) {
+    assert(window_ > order);
+  }
+
+  [[nodiscard]] auto delay() const noexcept -> std::size_t { return window_ / 2; }
+
+  /**
+   * @return (x, derivative) of the sample pushed delay() samples ago, once the window is full
+   */
+  auto push(T x, T y) -> std::optional<std::pair<T, T>> {
+    x_[position_] = x_[position_ + window_] = x;
+    y_[position_] = y_[position_ + window_] = y;
+    position_ = (position_ + 1) % window_;
+    count_++;
+
+    if (count_ < window_) return std::nullopt;
+
+    auto grid = std::span<const T>(x_).subspan(position_, window_);
+    auto values = std::span<const T>(y_).subspan(position_, window_);
+    const auto center = grid[window_ / 2];
+
+    implementation::fornberg(center, grid, order_, table_);
+
+    auto res = T{};
+    for (auto j = 0u; j < window_; j++) res += table_[j * (order_ + 1) + order_] * values[j];
+    return std::pair{center, res};
+  }
+};
+
+/**
+ * @brief Derivative of the given order at every sample of a whole series of (x, y) samples.
+ *
+ * Uses points consecutive samples around each sample, shifted to one sided stencils at the ends.
+ */
+template <FloatingPoint T, std::ranges::random_access_range X, std::ranges::random_access_range Y>
+auto differentiateSamples(X const& x, Y const& y, std::size_t order = 1, std::size_t points = 5) -> std::vector<T> {
+  const auto n = static_cast<std::size_t>(std::ranges::size(x));
+  assert(n == static_cast<std::size_t>(std::ranges::size(y)));
+  points = std::min(points, n);
+  assert(points > order);
+
+  std::vector<T> grid(points);
+  std::vector<T> table;
+  std::vector<T> res(n);
+
+  for (auto i = std::size_t{0}; i < n; i++) {
+    const auto first = std::min(i - std::min(i, points / 2), n - points);
+    for (auto j = 0u; j < points; j++) grid[j] = static_cast<T>(x[first + j]);
+
+    implementation::fornberg(static_cast<T>(x[i]), std::span<const T>(grid), order, table);
+
+    auto value = T{};
+    for (auto j = 0u; j < points; j++) value += table[j * (order + 1) + order] * static_cast<T>(y[first + j]);
+    res[i] = value;
+  }
+
+  return res;
+}
+
+}  // namespace jr_numeric::differential
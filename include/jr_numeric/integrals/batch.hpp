@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include "jr_numeric/integrals/gauss_quadrature.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+namespace jr_numeric::integrals {
+
+using concepts::FloatingPoint;
+
+/**
+ * @brief Gauss-Legendre nodes and weights already transformed to a fixed domain.
+ */
+template <FloatingPoint T>
+struct QuadratureNodes {
+  std::vector<T> x_;
+  std::vector<T> w_;
+};
+
+/**
+ * @brief Composite 10 point Gauss-Legendre rule on [low, high] split into panels equal subintervals.
+ */
+template <FloatingPoint T>
+auto gaussNodes(T low, T high, std::size_t panels = 1) -> QuadratureNodes<T> {
+  assert(panels > 0);
+  constexpr auto kParams = generateParams<T>();
+
+  QuadratureNodes<T> nodes;
+  nodes.x_.reserve(panels * kParams.size());
+  nodes.w_.reserve(panels * kParams.size());
+
+  const auto panel_width = (high - low) / panels;
+  for (auto panel = 0u; panel < panels; panel++) {
+    const auto panel_low = low + panel * panel_width;
+    const auto half = panel_width / 2;
+    for (const auto [x, w] : kParams) {
+      nodes.x_.push_back(panel_low + half * (x + 1));
+      nodes.w_.push_back(half * w);
+    }
+  }
+
+  return nodes;
+}
+
+namespace implementation {
+
+constexpr std::size_t kBatchBlock = 64;
+
+}  // namespace implementation
+
+/**
+ * @brief Integrates kernel(x, param) over the domain of nodes for every param.
+ *
+ * Parameters are processed in blocks, for each node the kernel is evaluated for the whole block so that the node is
+ * loaded once per block. Blocks are spread over threads, the kernel must be safe to call concurrently.
+ *
+ * @return integrals in the order of params
+ */
+template <FloatingPoint T, std::ranges::random_access_range Params, typename Kernel>
+  requires std::invocable<Kernel const&, T, std::ranges::range_reference_t<Params const>>
+auto integrateBatch(
+    QuadratureNodes<T> const& nodes,
+    Kernel const& kernel,
+    Params const& params,
+    std::size_t threads = utils::hardwareThreads()) -> std::vector<T> {
+  using implementation::kBatchBlock;
+
+  const auto n = static_cast<std::size_t>(std::ranges::size(params));
+  std::vector<T> results(n);
+
+  auto const begin = std::ranges::begin(params);
+
+  utils::parallelChunks(n, threads, [&](std::size_t, std::size_t chunk_begin, std::size_t chunk_end) {
+    for (auto block = chunk_begin; block < chunk_end; block += kBatchBlock) {
+      const auto block_size = std::min(kBatchBlock, chunk_end - block);
+      std::array<T, kBatchBlock> acc{};
+
+      for (auto i = 0u; i < nodes.x_.size(); i++) {
+        const auto x = nodes.x_[i];
+        const auto w = nodes.w_[i];
+        for (auto p = 0u; p < block_size; p++) {
+          acc[p] += w * static_cast<T>(std::invoke(kernel, x, begin[block + p]));
+        }
+      }
+
+      std::copy_n(acc.begin(), block_size, results.begin() + block);
+    }
+  });
+
+  return results;
+}
+
+/**
+ * @brief Integrates every function of the family over the domain of nodes.
+ */
+template <FloatingPoint T, std::ranges::random_access_range Functions>
+  requires concepts::R1RealFunction<std::ranges::range_value_t<Functions>>
+auto integrateBatch(
+    QuadratureNodes<T> const& nodes,
+    Functions const& functions,
+    std::size_t threads = utils::hardwareThreads()) -> std::vector<T> {
+  return integrateBatch(
+      nodes,
+      [](T x, auto const& function) { return function(x); },
+      functions,
+      threads);
+}
+
+}  // namespace jr_numeric::integrals
@@ -0,0 +1,262 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include "jr_numeric/integrals/utils.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+#include "jr_numeric/utils/meta.hpp"
+
+namespace jr_numeric::integrals {
+
+using concepts::FloatingPoint;
+
+template <FloatingPoint T>
+struct QuadratureResult {
+  T value_;
+  T error_estimate_;
+  std::size_t evaluations_;
+  std::size_t levels_;
+};
+
+enum class DoubleExponential {
+  KTanhSinh,  // [a, b]
+  KExpSinh,   // [a, inf)
+  KSinhSinh,  // (-inf, inf)
+};
+
+/**
+ * @brief Abscissas and weights of the tanh-sinh, exp-sinh and sinh-sinh rules for t >= 0.
+ *
+ * Level 0 holds the nodes t = 0, 1, 2, ..., every next level holds only the nodes at odd multiples of its step, so a
+ * refinement reuses all function values of the coarser levels. Nodes for t < 0 follow from symmetry.
+ */
+template <FloatingPoint T>
+class DoubleExponentialTables {
+ public:
+  struct Node {
+    T abscissa_;
+    T complement_;  // 1 - abscissa for tanh-sinh, kept separately so that points next to the endpoints are exact
+    T weight_;
+  };
+
+  using Level = std::vector<Node>;
+
+ private:
+  std::size_t max_levels_;
+  std::vector<Level> tanh_sinh_;
+  std::vector<Level> exp_sinh_;
+  std::vector<Level> sinh_sinh_;
+
+  template <typename NodeFunction>
+  static auto generate(std::size_t max_levels, NodeFunction const& node_at) -> std::vector<Level> {
+    std::vector<Level> levels(max_levels + 1);
+    for (auto level = 0u; level <= max_levels; level++) {
+      const auto h = std::ldexp(T{1}, -static_cast<int>(level));
+      for (auto j = std::uint64_t{0};; j++) {
+        const auto t = level == 0 ? static_cast<T>(j) : h * static_cast<T>(2 * j + 1);
+        auto node = node_at(t);
+        auto usable = std::isfinite(node.weight_) && std::isfinite(node.abscissa_) &&
+                      node.weight_ >= std::numeric_limits<T>::min();
+        if (!usable) break;
+        levels[level].push_back(node);
+      }
+    }
+    return levels;
+  }
+
+ public:
+  explicit DoubleExponentialTables(std::size_t max_levels = 8) : max_levels_(max_levels) {
+    constexpr auto kHalfPi = std::numbers::pi_v<T> / 2;
+
+    tanh_sinh_ = generate(max_levels, [](T t) {
+      const auto u = kHalfPi * std::sinh(t);
+      const auto cosh_u = std::cosh(u);
+      const auto complement = std::exp(-u) / cosh_u;
+      auto node = Node{std::tanh(u), complement, kHalfPi * std::cosh(t) / (cosh_u * cosh_u)};
+      if (complement < std::numeric_limits<T>::min()) node.weight_ = 0;
+      return node;
+    });
+
+    exp_sinh_ = generate(max_levels, [](T t) {
+      const auto x = std::exp(kHalfPi * std::sinh(t));
+      return Node{x, T{}, kHalfPi * std::cosh(t) * x};
+    });
+
+    sinh_sinh_ = generate(max_levels, [](T t) {
+      const auto u = kHalfPi * std::sinh(t);
+      return Node{std::sinh(u), T{}, kHalfPi * std::cosh(t) * std::cosh(u)};
+    });
+  }
+
+  [[nodiscard]] auto maxLevels() const noexcept -> std::size_t { return max_levels_; }
+
+  [[nodiscard]] auto levels(DoubleExponential rule) const noexcept -> std::vector<Level> const& {
+    switch (rule) {
+      case DoubleExponential::KTanhSinh:
+        return tanh_sinh_;
+      case DoubleExponential::KExpSinh:
+        return exp_sinh_;
+      case DoubleExponential::KSinhSinh:
+        return sinh_sinh_;
+    }
+    return tanh_sinh_;
+  }
+};
+
+namespace implementation {
+
+template <FloatingPoint T>
+auto defaultDoubleExponentialTables() -> DoubleExponentialTables<T> const& {
+  static const DoubleExponentialTables<T> kTables;
+  return kTables;
+}
+
+/**
+ * @param map_node maps a node (and a side, positive or negative t) to the abscissa and weight in the original variable
+ */
+template <FloatingPoint T, typename Function, typename MapNode>
+auto doubleExponentialSum(
+    DoubleExponentialTables<T> const& tables,
+    DoubleExponential rule,
+    Function const& function,
+    MapNode const& map_node,
+    T tolerance) -> QuadratureResult<T> {
+  auto const& levels = tables.levels(rule);
+  auto result = QuadratureResult<T>{};
+
+  // terms of level 0 decide how far in t the finer levels have to go
+  const auto& coarse = levels[0];
+  std::vector<T> terms_positive(coarse.size());
+  std::vector<T> terms_negative(coarse.size());
+
+  auto evaluate = [&](typename DoubleExponentialTables<T>::Node const& node, bool positive) -> T {
+    auto [x, w] = map_node(node, positive);
+    if (w == 0 || !std::isfinite(x)) return T{};
+    result.evaluations_++;
+    return w * static_cast<T>(function(x));
+  };
+
+  auto sum = T{};
+  for (auto j = 0u; j < coarse.size(); j++) {
+    terms_positive[j] = evaluate(coarse[j], true);
+    terms_negative[j] = j == 0 ? T{} : evaluate(coarse[j], false);
+    sum += terms_positive[j] + terms_negative[j];
+  }
+
+  auto cutoff = [&](std::vector<T> const& terms) {
+    const auto negligible = std::numeric_limits<T>::epsilon() * std::abs(sum);
+    auto last = terms.size();
+    while (last > 1 && std::abs(terms[last - 1]) <= negligible) last--;
+    return static_cast<T>(std::min(last + 1, terms.size()));
+  };
+
+  const auto t_max_positive = sum == 0 ? std::numeric_limits<T>::infinity() : cutoff(terms_positive);
+  const auto t_max_negative = sum == 0 ? std::numeric_limits<T>::infinity() : cutoff(terms_negative);
+
+  auto estimate = sum;
+  result.value_ = estimate;
+  result.error_estimate_ = std::numeric_limits<T>::infinity();
+
+  for (auto level = 1u; level < levels.size(); level++) {
+    const auto h = std::ldexp(T{1}, -static_cast<int>(level));
+    auto const& nodes = levels[level];
+
+    for (auto j = 0u; j < nodes.size(); j++) {
+      const auto t = h * static_cast<T>(2 * j + 1);
+      if (t > t_max_positive && t > t_max_negative) break;
+      if (t <= t_max_positive) sum += evaluate(nodes[j], true);
+      if (t <= t_max_negative) sum += evaluate(nodes[j], false);
+    }
+
+    const auto previous = estimate;
+    estimate = sum * h;
+
+    result.value_ = estimate;
+    result.error_estimate_ = std::abs(estimate - previous);
+    result.levels_ = level;
+
+    if (result.error_estimate_ <= tolerance * std::abs(estimate)) break;
+  }
+
+  return result;
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Double exponential quadrature.
+ *
+ * Picks tanh-sinh for finite bounds, exp-sinh when exactly one of the bounds is infinite and sinh-sinh for the whole
+ * real line. Endpoint singularities are fine as long as the function is finite in the interior, the function is never
+ * evaluated at a finite bound.
+ *
+ * @param tolerance relative tolerance of the difference between two consecutive levels. Every level roughly doubles
+ * the number of correct digits, so sqrt(epsilon) is enough to reach full precision.
+ */
+template <FloatingPoint T, concepts::Integral IntegralType>
+auto doubleExponential(
+    IntegralType const& integral,
+    T tolerance = std::sqrt(std::numeric_limits<T>::epsilon()),
+    DoubleExponentialTables<T> const& tables = implementation::defaultDoubleExponentialTables<T>())
+    -> QuadratureResult<T> {
+  using Node = typename DoubleExponentialTables<T>::Node;
+
+  auto const& function = integral.function_;
+  auto low = static_cast<T>(integral.low_);
+  auto high = static_cast<T>(integral.high_);
+
+  if (low == high) return QuadratureResult<T>{};
+  if (low > high) {
+    auto res = doubleExponential<T>(IntegralType{integral.high_, integral.low_, integral.function_}, tolerance, tables);
+    res.value_ = -res.value_;
+    return res;
+  }
+
+  const auto low_infinite = std::isinf(low);
+  const auto high_infinite = std::isinf(high);
+
+  struct Mapped {
+    T x_;
+    T w_;
+  };
+
+  if (!low_infinite && !high_infinite) {
+    const auto center = (low + high) / 2;
+    const auto radius = (high - low) / 2;
+    return implementation::doubleExponentialSum(
+        tables, DoubleExponential::KTanhSinh, function, [=](Node const& node, bool positive) {
+          const auto x = positive ? high - radius * node.complement_ : low + radius * node.complement_;
+          if (node.abscissa_ == 0) return Mapped{center, radius * node.weight_};
+          // abscissa collapsed onto the endpoint
+          if (x <= low || x >= high) return Mapped{x, T{}};
+          return Mapped{x, radius * node.weight_};
+        }, tolerance);
+  }
+
+  if (!low_infinite || !high_infinite) {
+    // x = low + s for [low, inf), x = high - s for (-inf, high]
+    const auto origin = low_infinite ? high : low;
+    const auto direction = low_infinite ? T{-1} : T{1};
+    return implementation::doubleExponentialSum(
+        tables, DoubleExponential::KExpSinh, function, [=](Node const& node, bool positive) {
+          const auto s = positive ? node.abscissa_ : 1 / node.abscissa_;
+          const auto w = positive ? node.weight_ : node.weight_ / (node.abscissa_ * node.abscissa_);
+          const auto x = origin + direction * s;
+          if (x == origin) return Mapped{x, T{}};
+          return Mapped{x, w};
+        }, tolerance);
+  }
+
+  return implementation::doubleExponentialSum(
+      tables, DoubleExponential::KSinhSinh, function, [](Node const& node, bool positive) {
+        return Mapped{positive ? node.abscissa_ : -node.abscissa_, node.weight_};
+      }, tolerance);
+}
+
+}  // namespace jr_numeric::integrals
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::integrals {
+
+using concepts::FloatingPoint;
+
+namespace implementation {
+
+// https://prng.di.unimi.it/splitmix64.c
+inline auto splitMix64(std::uint64_t& state) noexcept -> std::uint64_t {
+  auto z = (state += 0x9e3779b97f4a7c15);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+// primitive polynomials over GF(2) ordered by degree, encoded as bit masks (bit s stands for x^s)
+inline auto primitivePolynomials(std::size_t count) -> std::vector<std::uint32_t> {
+  std::vector<std::uint32_t> res;
+  res.reserve(count);
+
+  auto is_primitive = [](std::uint32_t poly, unsigned degree) {
+    const auto period = (std::uint32_t{1} << degree) - 1;
+    auto state = std::uint32_t{1};
+    for (auto i = 1u; i <= period; i++) {
+      state <<= 1;
+      if (state & (std::uint32_t{1} << degree)) state ^= poly;
+      if (state == 1) return i == period;
+    }
+    return false;
+  };
+
+  for (auto degree = 1u; res.size() < count; degree++) {
+    assert(degree < 31);
+    for (auto mid = std::uint32_t{0}; mid < (std::uint32_t{1} << (degree - 1)) && res.size() < count; mid++) {
+      auto poly = (std::uint32_t{1} << degree) | (mid << 1) | 1;
+      if (is_primitive(poly, degree)) res.push_back(poly);
+    }
+  }
+
+  return res;
+}
+
+inline auto primes(std::size_t count) -> std::vector<std::uint32_t> {
+  std::vector<std::uint32_t> res;
+  res.reserve(count);
+  for (auto candidate = std::uint32_t{2}; res.size() < count; candidate++) {
+    auto is_prime = std::none_of(res.begin(), res.end(), [candidate](auto p) {
+      return p * p <= candidate && candidate % p == 0;
+    });
+    if (is_prime) res.push_back(candidate);
+  }
+  return res;
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Sobol sequence in base 2 with optional Matousek linear scrambling and random digital shift.
+ *
+ * Direction numbers are derived from primitive polynomials generated at construction. Initial direction numbers are
+ * drawn deterministically from a fixed seed, the scrambling seed only affects the randomization.
+ * Points are generated in Gray code order, so a stream started at any index costs O(dimensions * 32) to set up
+ * and O(dimensions) per following point.
+ */
+class SobolSequence {
+ public:
+  static constexpr std::size_t kBits = 32;
+
+ private:
+  std::size_t dimensions_;
+  std::vector<std::uint32_t> directions_;  // dimensions_ x kBits
+  std::vector<std::uint32_t> shift_;
+
+  [[nodiscard]] auto direction(std::size_t dimension, std::size_t bit) const noexcept -> std::uint32_t {
+    return directions_[dimension * kBits + bit];
+  }
+
+  template <FloatingPoint T>
+  static auto toUnit(std::uint32_t state) noexcept -> T {
+    // center of the 2^-32 cell, so that 0 is never returned
+    return (static_cast<T>(state) + T{0.5}) / static_cast<T>(std::uint64_t{1} << kBits);
+  }
+
+ public:
+  class Stream {
+    SobolSequence const* sequence_;
+    std::uint64_t index_;
+    std::vector<std::uint32_t> state_;
+
+   public:
+    Stream(SobolSequence const& sequence, std::uint64_t first) : sequence_(&sequence), index_(first) {
+      state_.resize(sequence.dimensions_);
+      const auto gray = first ^ (first >> 1);
+      for (auto d = 0u; d < sequence.dimensions_; d++) {
+        auto state = std::uint32_t{};
+        for (auto bit = 0u; bit < kBits; bit++) {
+          if ((gray >> bit) & 1) state ^= sequence.direction(d, bit);
+        }
+        state_[d] = state;
+      }
+    }
+
+    [[nodiscard]] auto index() const noexcept -> std::uint64_t { return index_; }
+
+    template <FloatingPoint T>
+    auto next(std::span<T> out) -> void {
+      assert(out.size() == state_.size());
+      assert(index_ + 1 < (std::uint64_t{1} << kBits));
+
+      for (auto d = 0u; d < state_.size(); d++) {
+        out[d] = toUnit<T>(state_[d] ^ sequence_->shift_[d]);
+      }
+
+      const auto bit = static_cast<std::size_t>(std::countr_one(index_));
+      for (auto d = 0u; d < state_.size(); d++) {
+        state_[d] ^= sequence_->direction(d, bit);
+      }
+      index_++;
+    }
+  };
+
+  explicit SobolSequence(std::size_t dimensions, std::uint64_t seed = 0, bool scramble = true)
+      : dimensions_(dimensions), directions_(dimensions * kBits), shift_(dimensions) {
+    assert(dimensions > 0);
+
+    auto const polynomials = implementation::primitivePolynomials(dimensions - 1);
+    auto direction_state = std::uint64_t{0x5eed};
+
+    // first dimension is van der Corput sequence
+    for (auto bit = 0u; bit < kBits; bit++) {
+      directions_[bit] = std::uint32_t{1} << (kBits - 1 - bit);
+    }
+
+    for (auto d = 1u; d < dimensions; d++) {
+      auto const poly = polynomials[d - 1];
+      auto const degree = static_cast<std::size_t>(std::bit_width(poly) - 1);
+      auto* v = &directions_[d * kBits];
+
+      for (auto k = 0u; k < std::min(degree, kBits); k++) {
+        // m_k odd and smaller than 2^(k + 1)
+        auto m = static_cast<std::uint32_t>((implementation::splitMix64(direction_state) % (1u << k)) * 2 + 1);
+        v[k] = m << (kBits - 1 - k);
+      }
+      for (auto k = degree; k < kBits; k++) {
+        v[k] = v[k - degree] ^ (v[k - degree] >> degree);
+        for (auto i = 1u; i < degree; i++) {
+          if ((poly >> (degree - i)) & 1) v[k] ^= v[k - i];
+        }
+      }
+    }
+
+    if (!scramble) return;
+
+    auto random_state = seed;
+    for (auto d = 0u; d < dimensions; d++) {
+      // lower triangular matrix with unit diagonal, row r produces bit (kBits - 1 - r) counting from the MSB
+      std::array<std::uint32_t, kBits> rows{};
+      for (auto r = 0u; r < kBits; r++) {
+        auto const higher = static_cast<std::uint32_t>(~((std::uint64_t{1} << (kBits - r)) - 1));
+        rows[r] = (static_cast<std::uint32_t>(implementation::splitMix64(random_state)) & higher) |
+                  (std::uint32_t{1} << (kBits - 1 - r));
+      }
+
+      for (auto bit = 0u; bit < kBits; bit++) {
+        auto const v = directions_[d * kBits + bit];
+        auto scrambled = std::uint32_t{};
+        for (auto r = 0u; r < kBits; r++) {
+          scrambled |= static_cast<std::uint32_t>(std::popcount(rows[r] & v) & 1) << (kBits - 1 - r);
+        }
+        directions_[d * kBits + bit] = scrambled;
+      }
+
+      shift_[d] = static_cast<std::uint32_t>(implementation::splitMix64(random_state));
+    }
+  }
+
+  [[nodiscard]] auto dimensions() const noexcept -> std::size_t { return dimensions_; }
+
+  [[nodiscard]] auto stream(std::uint64_t first = 0) const -> Stream { return Stream(*this, first); }
+
+  template <FloatingPoint T>
+  auto point(std::uint64_t index, std::span<T> out) const -> void {
+    stream(index).next(out);
+  }
+};
+
+/**
+ * @brief Halton sequence with optional random digit permutation scrambling.
+ *
+ * Every point is computed directly from its index, so skipping ahead is free.
+ */
+class HaltonSequence {
+  std::size_t dimensions_;
+  std::vector<std::uint32_t> bases_;
+  std::vector<std::size_t> depths_;
+  std::vector<std::size_t> offsets_;         // offset of dimension's permutations in permutations_
+  std::vector<std::uint32_t> permutations_;  // depth x base digits for every dimension
+
+ public:
+  class Stream {
+    HaltonSequence const* sequence_;
+    std::uint64_t index_;
+
+   public:
+    Stream(HaltonSequence const& sequence, std::uint64_t first) : sequence_(&sequence), index_(first) {}
+
+    [[nodiscard]] auto index() const noexcept -> std::uint64_t { return index_; }
+
+    template <FloatingPoint T>
+    auto next(std::span<T> out) -> void {
+      sequence_->point(index_++, out);
+    }
+  };
+
+  explicit HaltonSequence(std::size_t dimensions, std::uint64_t seed = 0, bool scramble = true)
+      : dimensions_(dimensions), bases_(implementation::primes(dimensions)), depths_(dimensions), offsets_(dimensions) {
+    assert(dimensions > 0);
+
+    auto random_state = seed;
+
+    for (auto d = 0u; d < dimensions; d++) {
+      auto const base = bases_[d];
+      // enough digits to represent any 32 bit index
+      depths_[d] = static_cast<std::size_t>(std::ceil(32 * std::log(2.) / std::log(static_cast<double>(base))));
+      offsets_[d] = permutations_.size();
+
+      for (auto level = 0u; level < depths_[d]; level++) {
+        auto first = permutations_.size();
+        permutations_.resize(first + base);
+        auto digits = std::span(permutations_).subspan(first, base);
+        std::iota(digits.begin(), digits.end(), 0u);
+
+        if (!scramble) continue;
+        for (auto i = base - 1; i > 0; i--) {
+          auto j = implementation::splitMix64(random_state) % (i + 1);
+          std::swap(digits[i], digits[j]);
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] auto dimensions() const noexcept -> std::size_t { return dimensions_; }
+
+  [[nodiscard]] auto stream(std::uint64_t first = 0) const -> Stream { return Stream(*this, first); }
+
+  template <FloatingPoint T>
+  auto point(std::uint64_t index, std::span<T> out) const -> void {
+    assert(out.size() == dimensions_);
+    assert(index < (std::uint64_t{1} << 32));
+
+    for (auto d = 0u; d < dimensions_; d++) {
+      auto const base = bases_[d];
+      auto const* permutation = &permutations_[offsets_[d]];
+
+      auto res = T{};
+      auto factor = T{1} / base;
+      auto remaining = index;
+      for (auto level = 0u; level < depths_[d]; level++) {
+        res += factor * permutation[level * base + remaining % base];
+        remaining /= base;
+        factor /= base;
+      }
+
+      out[d] = res + factor * base / 2;
+    }
+  }
+};
+
+}  // namespace jr_numeric::integrals
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "jr_numeric/integrals/low_discrepancy.hpp"
+#include "jr_numeric/statistics/accumulator.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+namespace jr_numeric::integrals {
+
+using concepts::FloatingPoint;
+using concepts::ScalarField;
+
+template <FloatingPoint T, std::size_t N>
+struct Hypercube {
+  std::array<T, N> low_{};
+  std::array<T, N> high_{};
+};
+
+enum class LowDiscrepancy {
+  KSobol,
+  KHalton,
+};
+
+template <FloatingPoint T>
+struct MonteCarloOptions {
+  LowDiscrepancy sequence_ = LowDiscrepancy::KSobol;
+  T target_error_ = 1e-6;
+  std::size_t initial_points_ = 1024;  // per replica, doubled every round
+  std::size_t max_evaluations_ = std::size_t{1} << 24;
+  std::size_t replicas_ = 8;  // independently scrambled sequences, used to estimate the error
+  std::uint64_t seed_ = 0;
+  std::size_t threads_ = utils::hardwareThreads();
+};
+
+template <FloatingPoint T>
+struct MonteCarloResult {
+  T value_;
+  T variance_;  // variance of the integrand scaled by the volume
+  T std_error_;
+  std::size_t evaluations_;
+  bool converged_;
+};
+
+namespace implementation {
+
+template <FloatingPoint T, std::size_t N, typename Sequence, ScalarField<N> Function>
+auto quasiMonteCarlo(Function const& function, Hypercube<T, N> const& domain, MonteCarloOptions<T> const& options)
+    -> MonteCarloResult<T> {
+  assert(options.replicas_ > 1);
+  assert(options.initial_points_ > 0);
+
+  std::array<T, N> width;
+  for (auto d = 0u; d < N; d++) width[d] = domain.high_[d] - domain.low_[d];
+  const auto volume = std::reduce(width.begin(), width.end(), T{1}, std::multiplies<>{});
+
+  auto random_state = options.seed_;
+  std::vector<Sequence> sequences;
+  std::vector<statistics::Accumulator<T>> replica_moments(options.replicas_);
+  sequences.reserve(options.replicas_);
+  for (auto r = 0u; r < options.replicas_; r++) {
+    sequences.emplace_back(N, implementation::splitMix64(random_state));
+  }
+
+  auto evaluate_range = [&](Sequence const& sequence, std::uint64_t begin, std::uint64_t end) {
+    statistics::Accumulator<T> moments;
+    std::array<T, N> point;
+    auto stream = sequence.stream(begin);
+    for (auto i = begin; i < end; i++) {
+      stream.next(std::span<T>(point));
+      for (auto d = 0u; d < N; d++) point[d] = domain.low_[d] + width[d] * point[d];
+      moments.push(static_cast<T>(std::apply(function, point)));
+    }
+    return moments;
+  };
+
+  auto result = MonteCarloResult<T>{};
+  std::vector<statistics::Accumulator<T>> partial(std::max<std::size_t>(options.threads_, 1));
+
+  for (auto begin = std::size_t{0}, end = options.initial_points_;; begin = end, end *= 2) {
+    for (auto r = 0u; r < options.replicas_; r++) {
+      auto chunks = utils::parallelChunks(
+          end - begin, options.threads_, [&](std::size_t id, std::size_t chunk_begin, std::size_t chunk_end) {
+            partial[id] = evaluate_range(sequences[r], begin + chunk_begin, begin + chunk_end);
+          });
+      for (auto id = 0u; id < chunks; id++) replica_moments[r].merge(partial[id]);
+    }
+    result.evaluations_ += options.replicas_ * (end - begin);
+
+    statistics::Accumulator<T> estimates;
+    statistics::Accumulator<T> combined;
+    for (auto const& moments : replica_moments) {
+      estimates.push(volume * moments.mean_);
+      combined.merge(moments);
+    }
+
+    result.value_ = estimates.mean_;
+    result.std_error_ = std::sqrt(estimates.m2_ / (estimates.count_ - 1) / estimates.count_);
+    result.variance_ = volume * volume * combined.m2_ / (combined.count_ - 1);
+    result.converged_ = result.std_error_ <= options.target_error_;
+
+    if (result.converged_ || result.evaluations_ + options.replicas_ * end > options.max_evaluations_) break;
+  }
+
+  return result;
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Randomized quasi Monte Carlo integration of function over domain.
+ *
+ * Every replica is an independently scrambled low discrepancy sequence. The number of points per replica is doubled
+ * every round until the standard error estimated from the spread of the replicas drops below the target error or the
+ * evaluation budget is exhausted. Each thread starts its own stream at the beginning of its chunk, so the function
+ * must be safe to call concurrently.
+ */
+template <FloatingPoint T, std::size_t N, ScalarField<N> Function>
+auto quasiMonteCarlo(Function const& function, Hypercube<T, N> const& domain, MonteCarloOptions<T> const& options = {})
+    -> MonteCarloResult<T> {
+  switch (options.sequence_) {
+    case LowDiscrepancy::KSobol:
+      return implementation::quasiMonteCarlo<T, N, SobolSequence>(function, domain, options);
+    case LowDiscrepancy::KHalton:
+      return implementation::quasiMonteCarlo<T, N, HaltonSequence>(function, domain, options);
+  }
+  return {};
+}
+
+}  // namespace jr_numeric::integrals
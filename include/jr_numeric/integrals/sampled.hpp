@@ -0,0 +1,241 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/algebra/tridiagonal.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::integrals {
+
+using concepts::FloatingPoint;
+
+enum class SampledRule {
+  KTrapezoid,
+  KSimpson,  // piecewise quadratic, works for non uniform spacing and odd number of intervals
+  KSpline,   // natural cubic spline, needs the whole series
+};
+
+namespace implementation {
+
+// integrals over [x0, x1] and [x1, x2] of the parabola through (x0, y0), (x1, y1), (x2, y2); h0 = x1 - x0, h1 = x2 - x1
+template <FloatingPoint T>
+auto parabolaHalves(T h0, T h1, T y0, T y1, T y2) noexcept -> std::pair<T, T> {
+  const auto h = h0 + h1;
+  const auto first = h0 / 6 * ((2 * h0 + 3 * h1) / h * y0 + (h0 + 3 * h1) / h1 * y1 - h0 * h0 / (h * h1) * y2);
+  const auto second = h1 / 6 * ((2 * h1 + 3 * h0) / h * y2 + (h1 + 3 * h0) / h0 * y1 - h1 * h1 / (h * h0) * y0);
+  return {first, second};
+}
+
+template <FloatingPoint T, typename X, typename Y>
+auto naturalSplineSecondDerivatives(X const& x, Y const& y) -> std::vector<T> {
+  const auto n = static_cast<std::size_t>(std::ranges::size(x));
+  std::vector<T> m(n);
+  if (n < 3) return m;
+
+  const auto inner = n - 2;
+  std::vector<T> lower(inner);
+  std::vector<T> diagonal(inner);
+  std::vector<T> upper(inner);
+
+  for (auto i = 1u; i + 1 < n; i++) {
+    const auto h_prev = static_cast<T>(x[i] - x[i - 1]);
+    const auto h_next = static_cast<T>(x[i + 1] - x[i]);
+    lower[i - 1] = h_prev;
+    diagonal[i - 1] = 2 * (h_prev + h_next);
+    upper[i - 1] = h_next;
+    m[i] = 6 * ((y[i + 1] - y[i]) / h_next - (y[i] - y[i - 1]) / h_prev);
+  }
+
+  algebra::solveTridiagonal<T>(lower, diagonal, upper, std::span(m).subspan(1, inner));
+  return m;
+}
+
+/**
+ * @brief calls on_interval(i, integral over [x_i, x_i+1]) for every interval in order
+ */
+template <FloatingPoint T, typename X, typename Y, typename OnInterval>
+auto forEachInterval(X const& x, Y const& y, SampledRule rule, OnInterval const& on_interval) -> void {
+  const auto n = static_cast<std::size_t>(std::ranges::size(x));
+  assert(n == static_cast<std::size_t>(std::ranges::size(y)));
+  if (n < 2) return;
+
+  auto h = [&x](std::size_t i) { return static_cast<T>(x[i + 1] - x[i]); };
+
+  if (rule == SampledRule::KSimpson && n < 3) rule = SampledRule::KTrapezoid;
+
+  switch (rule) {
+    case SampledRule::KTrapezoid:
+      for (auto i = 0u; i + 1 < n; i++) {
+        on_interval(i, h(i) * (static_cast<T>(y[i]) + static_cast<T>(y[i + 1])) / 2);
+      }
+      break;
+    case SampledRule::KSimpson:
+      for (auto i = 0u; i + 2 < n; i += 2) {
+        auto [first, second] = parabolaHalves<T>(h(i), h(i + 1), y[i], y[i + 1], y[i + 2]);
+        on_interval(i, first);
+        on_interval(i + 1, second);
+      }
+      if (n % 2 == 0) {
+        // odd number of intervals, the last one comes from the parabola through the last three samples
+        on_interval(n - 2, parabolaHalves<T>(h(n - 3), h(n - 2), y[n - 3], y[n - 2], y[n - 1]).second);
+      }
+      break;
+    case SampledRule::KSpline: {
+      auto m = naturalSplineSecondDerivatives<T>(x, y);
+      for (auto i = 0u; i + 1 < n; i++) {
+        const auto h_i = h(i);
+        on_interval(
+            i, h_i * (static_cast<T>(y[i]) + static_cast<T>(y[i + 1])) / 2 - h_i * h_i * h_i * (m[i] + m[i + 1]) / 24);
+      }
+      break;
+    }
+  }
+}
+
+template <FloatingPoint T>
+auto uniformGrid(std::size_t n, T dx, T x0) {
+  return std::views::iota(std::size_t{0}, n) |
+         std::views::transform([dx, x0](std::size_t i) { return x0 + static_cast<T>(i) * dx; });
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Integrates tabulated (x, y) data, x has to be increasing but does not have to be uniform.
+ */
+template <FloatingPoint T, std::ranges::random_access_range X, std::ranges::random_access_range Y>
+auto integrateSamples(X const& x, Y const& y, SampledRule rule = SampledRule::KSimpson) -> T {
+  auto res = T{};
+  implementation::forEachInterval<T>(x, y, rule, [&res](std::size_t, T integral) { res += integral; });
+  return res;
+}
+
+/**
+ * @param samples (x, y) pairs, e.g. LagrangePolynomial::SamplesVector
+ */
+template <FloatingPoint T, std::ranges::random_access_range Samples>
+auto integrateSamples(Samples const& samples, SampledRule rule = SampledRule::KSimpson) -> T {
+  return integrateSamples<T>(std::views::keys(samples), std::views::values(samples), rule);
+}
+
+/**
+ * @brief Integrates uniformly sampled values, e.g. a dataset read with utils::readDataset
+ */
+template <FloatingPoint T, std::ranges::random_access_range Y>
+auto integrateSamples(Y const& y, T dx, SampledRule rule = SampledRule::KSimpson) -> T {
+  return integrateSamples<T>(implementation::uniformGrid(std::ranges::size(y), dx, T{}), y, rule);
+}
+
+/**
+ * @return integrals from x[0] to every x[i], the first element is 0
+ */
+template <FloatingPoint T, std::ranges::random_access_range X, std::ranges::random_access_range Y>
+auto cumulativeIntegral(X const& x, Y const& y, SampledRule rule = SampledRule::KSimpson) -> std::vector<T> {
+  std::vector<T> res(std::ranges::size(x));
+  implementation::forEachInterval<T>(
+      x, y, rule, [&res](std::size_t i, T integral) { res[i + 1] = res[i] + integral; });
+  return res;
+}
+
+template <FloatingPoint T, std::ranges::random_access_range Samples>
+auto cumulativeIntegral(Samples const& samples, SampledRule rule = SampledRule::KSimpson) -> std::vector<T> {
+  return cumulativeIntegral<T>(std::views::keys(samples), std::views::values(samples), rule);
+}
+
+template <FloatingPoint T, std::ranges::random_access_range Y>
+auto cumulativeIntegral(Y const& y, T dx, SampledRule rule = SampledRule::KSimpson) -> std::vector<T> {
+  return cumulativeIntegral<T>(implementation::uniformGrid(std::ranges::size(y), dx, T{}), y, rule);
+}
+
+/**
+ * @brief Integrates a series pushed chunk by chunk, keeping only the last samples.
+ *
+ * For the Simpson rule pairs of intervals are closed as soon as they are complete. A trailing unpaired interval is
+ * covered by the parabola through the last three samples, the same way integrateSamples does it, so the value is
+ * the same as if the whole series was integrated at once. The spline rule is global and is not supported.
+ */
+template <FloatingPoint T>
+class StreamingIntegral {
+  SampledRule rule_;
+  std::array<std::pair<T, T>, 3> last_{};  // last_[0] is the newest sample
+  std::size_t count_{};
+  T closed_{};  // integral up to the last even sample (Simpson) or up to the last sample (trapezoid)
+
+  // uniform chunks of the same dx continue one grid, x = origin_ + (count_ - origin_count_) * dx_
+  T origin_{};
+  std::size_t origin_count_{};
+  T dx_{};
+  bool uniform_{};
+
+  auto append(T x, T y) -> void {
+    last_[2] = last_[1];
+    last_[1] = last_[0];
+    last_[0] = {x, y};
+    count_++;
+
+    if (count_ < 2) return;
+
+    auto const& [x0, y0] = last_[1];
+    if (rule_ == SampledRule::KTrapezoid || count_ == 2) {
+      if (rule_ == SampledRule::KTrapezoid) closed_ += (x - x0) * (y + y0) / 2;
+      return;
+    }
+
+    if (count_ % 2 == 1) {
+      auto const& [x2, y2] = last_[2];
+      auto [first, second] = implementation::parabolaHalves<T>(x0 - x2, x - x0, y2, y0, y);
+      closed_ += first + second;
+    }
+  }
+
+ public:
+  explicit StreamingIntegral(SampledRule rule = SampledRule::KSimpson) : rule_(rule) {
+    assert(rule != SampledRule::KSpline);
+  }
+
+  auto push(T x, T y) -> void {
+    uniform_ = false;
+    append(x, y);
+  }
+
+  template <std::ranges::input_range Samples>
+  auto push(Samples const& samples) -> void {
+    for (auto const& [x, y] : samples) push(x, y);
+  }
+
+  /**
+   * @brief samples dx apart, following the last sample or starting at x = 0
+   */
+  auto push(std::span<const T> y, T dx) -> void {
+    if (!uniform_ || dx != dx_) {
+      // the first sample of a new grid is at origin_ itself
+      origin_ = count_ == 0 ? T{} : last_[0].first;
+      origin_count_ = count_ == 0 ? 1 : count_;
+      dx_ = dx;
+      uniform_ = true;
+    }
+    for (const auto value : y) append(origin_ + static_cast<T>(count_ + 1 - origin_count_) * dx_, value);
+  }
+
+  [[nodiscard]] auto count() const noexcept -> std::size_t { return count_; }
+
+  [[nodiscard]] auto value() const noexcept -> T {
+    if (rule_ == SampledRule::KTrapezoid || count_ < 2) return closed_;
+
+    auto const& [x, y] = last_[0];
+    auto const& [x0, y0] = last_[1];
+    if (count_ == 2) return (x - x0) * (y + y0) / 2;
+    if (count_ % 2 == 1) return closed_;
+
+    auto const& [x2, y2] = last_[2];
+    return closed_ + implementation::parabolaHalves<T>(x0 - x2, x - x0, y2, y0, y).second;
+  }
+};
+
+}  // namespace jr_numeric::integrals
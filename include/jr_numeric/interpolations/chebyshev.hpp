@@ -0,0 +1,262 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/root_finding/polynomial.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::interpolations {
+
+using concepts::FloatingPoint;
+
+template <FloatingPoint T>
+struct ChebyshevOptions {
+  T tolerance_ = 16 * std::numeric_limits<T>::epsilon();  // coefficients below it, relative to the largest, are dropped
+  std::size_t min_degree_ = 16;                            // power of two, the first sampling
+  std::size_t max_degree_ = std::size_t{1} << 16;          // power of two, stops the refinement
+};
+
+namespace implementation {
+
+// in place radix 2 Cooley-Tukey, data.size() has to be a power of two
+template <FloatingPoint T>
+auto fft(std::span<std::complex<T>> data) noexcept -> void {
+  const auto n = data.size();
+  assert((n & (n - 1)) == 0);
+
+  for (auto i = std::size_t{1}, j = std::size_t{0}; i < n; i++) {
+    auto bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) std::swap(data[i], data[j]);
+  }
+
+  for (auto length = std::size_t{2}; length <= n; length <<= 1) {
+    const auto angle = -2 * std::numbers::pi_v<T> / static_cast<T>(length);
+    for (auto k = 0u; k < length / 2; k++) {
+      const auto twiddle = std::polar(T{1}, angle * static_cast<T>(k));
+      for (auto i = std::size_t{0}; i < n; i += length) {
+        const auto even = data[i + k];
+        const auto odd = data[i + k + length / 2] * twiddle;
+        data[i + k] = even + odd;
+        data[i + k + length / 2] = even - odd;
+      }
+    }
+  }
+}
+
+/**
+ * @brief coefficients of the interpolant through values at the n + 1 Chebyshev points cos(pi k / n), by a DCT-I
+ * computed as an FFT of the even extension, O(n log n)
+ */
+template <FloatingPoint T>
+auto chebyshevCoefficients(std::span<const T> values) -> std::vector<T> {
+  const auto n = values.size() - 1;
+  if (n == 0) return {values[0]};
+
+  std::vector<std::complex<T>> extended(2 * n);
+  for (auto k = 0u; k <= n; k++) extended[k] = values[k];
+  for (auto k = 1u; k < n; k++) extended[2 * n - k] = values[k];
+  fft<T>(extended);
+
+  std::vector<T> res(n + 1);
+  for (auto j = 0u; j <= n; j++) res[j] = extended[j].real() / static_cast<T>(n);
+  res[0] /= 2;
+  res[n] /= 2;
+  return res;
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Polynomial approximation sum(c_k * T_k(x)) of a function on [low, high].
+ *
+ * approximate samples the function at Chebyshev points, doubling their number (and reusing the old samples) until the
+ * trailing coefficients fall below the tolerance, then drops the negligible tail. Evaluation is Clenshaw's recurrence,
+ * O(degree) and stable. Derivatives, antiderivatives and roots are computed on the coefficients.
+ */
+template <FloatingPoint T>
+class Chebyshev {
+  // roots of a higher degree are found on the two halves, the colleague matrix eigenvalues are O(degree^3)
+  static constexpr std::size_t kMaxColleague = 64;
+
+  T low_;
+  T high_;
+  std::vector<T> coefficients_;
+
+  [[nodiscard]] auto toUnit(T t) const noexcept -> T { return (2 * t - low_ - high_) / (high_ - low_); }
+
+  [[nodiscard]] auto fromUnit(T x) const noexcept -> T { return (low_ + high_) / 2 + (high_ - low_) / 2 * x; }
+
+  // eigenvalues of the colleague matrix, the Chebyshev analogue of the companion matrix
+  auto colleagueRoots(std::vector<T>& roots) const -> void {
+    const auto n = degree();
+    if (n == 0) return;
+    if (n == 1) {
+      const auto x = -coefficients_[0] / coefficients_[1];
+      const auto tolerance = std::sqrt(std::numeric_limits<T>::epsilon());
+      if (std::abs(x) <= 1 + tolerance) roots.push_back(fromUnit(std::clamp(x, T{-1}, T{1})));
+      return;
+    }
+
+    // x [T_0 .. T_n-1] = M [T_0 .. T_n-1] at a root, stored transposed to get an upper Hessenberg matrix
+    std::vector<T> a(n * n, T{});
+    auto at = [&a, n](std::size_t i, std::size_t j) -> T& { return a[j * n + i]; };
+    at(0, 1) = 1;
+    for (auto k = 1u; k + 1 < n; k++) at(k, k - 1) = at(k, k + 1) = T{0.5};
+    at(n - 1, n - 2) = T{0.5};
+    for (auto k = 0u; k < n; k++) at(n - 1, k) -= coefficients_[k] / (2 * coefficients_[n]);
+
+    roots::implementation::balance(a, n);
+    std::vector<std::complex<T>> eigenvalues(n);
+    roots::implementation::hessenbergEigenvalues(a, n, std::span(eigenvalues));
+
+    const auto tolerance = std::sqrt(std::numeric_limits<T>::epsilon());
+    for (const auto e : eigenvalues) {
+      if (std::abs(e.imag()) > tolerance || std::abs(e.real()) > 1 + tolerance) continue;
+      roots.push_back(fromUnit(std::clamp(e.real(), T{-1}, T{1})));
+    }
+  }
+
+  auto collectRoots(std::vector<T>& roots, ChebyshevOptions<T> const& options) const -> void {
+    if (degree() <= kMaxColleague) {
+      colleagueRoots(roots);
+      return;
+    }
+    // slightly off center, so that a root in the middle of a symmetric problem does not land on the split
+    const auto split = low_ + (high_ - low_) * T{0.4975};
+    approximate(*this, low_, split, options).collectRoots(roots, options);
+    approximate(*this, split, high_, options).collectRoots(roots, options);
+  }
+
+ public:
+  /**
+   * @param coefficients c_k of sum(c_k * T_k(x)), x = (2t - low - high) / (high - low)
+   */
+  Chebyshev(T low, T high, std::vector<T> coefficients)
+      : low_(low), high_(high), coefficients_(std::move(coefficients)) {
+    assert(low < high);
+    if (coefficients_.empty()) coefficients_.push_back(T{});
+  }
+
+  template <concepts::R1RealFunction Function>
+  static auto approximate(Function const& function, T low, T high, ChebyshevOptions<T> const& options = {})
+      -> Chebyshev {
+    assert(low < high);
+    assert(options.min_degree_ >= 2 && (options.min_degree_ & (options.min_degree_ - 1)) == 0);
+
+    auto n = options.min_degree_;
+    std::vector<T> values(n + 1);
+    auto point = [&](std::size_t k, std::size_t n) {
+      return (low + high) / 2 + (high - low) / 2 * std::cos(std::numbers::pi_v<T> * static_cast<T>(k) / n);
+    };
+    for (auto k = 0u; k <= n; k++) values[k] = function(point(k, n));
+
+    for (;;) {
+      auto coefficients = implementation::chebyshevCoefficients<T>(values);
+
+      auto scale = T{};
+      for (const auto c : coefficients) scale = std::max(scale, std::abs(c));
+      const auto threshold = options.tolerance_ * scale;
+
+      // the tail has to be resolved over a few coefficients, a single small one can be a coincidence
+      const auto tail = std::max<std::size_t>(3, n / 16);
+      const auto resolved =
+          std::all_of(coefficients.end() - tail, coefficients.end(), [&](T c) { return std::abs(c) <= threshold; });
+
+      if (resolved || 2 * n > options.max_degree_) {
+        while (coefficients.size() > 1 && std::abs(coefficients.back()) <= threshold) coefficients.pop_back();
+        return Chebyshev(low, high, std::move(coefficients));
+      }
+
+      // points of 2n are the old points at even indices
+      std::vector<T> refined(2 * n + 1);
+      for (auto k = 0u; k <= n; k++) refined[2 * k] = values[k];
+      for (auto k = 1u; k < 2 * n; k += 2) refined[k] = function(point(k, 2 * n));
+      values = std::move(refined);
+      n *= 2;
+    }
+  }
+
+  [[nodiscard]] auto operator()(T t) const noexcept -> T {
+    const auto x = toUnit(t);
+    auto b1 = T{}, b2 = T{};
+    for (auto k = coefficients_.size() - 1; k > 0; k--) {
+      const auto b = coefficients_[k] + 2 * x * b1 - b2;
+      b2 = b1;
+      b1 = b;
+    }
+    return coefficients_[0] + x * b1 - b2;
+  }
+
+  [[nodiscard]] auto derivative() const -> Chebyshev {
+    const auto n = degree();
+    if (n == 0) return Chebyshev(low_, high_, {T{}});
+
+    std::vector<T> res(n);
+    const auto scale = 2 / (high_ - low_);
+    for (auto k = n; k > 0; k--) {
+      res[k - 1] = (k + 1 < n ? res[k + 1] : T{}) + 2 * static_cast<T>(k) * coefficients_[k];
+    }
+    res[0] /= 2;
+    for (auto& c : res) c *= scale;
+    return Chebyshev(low_, high_, std::move(res));
+  }
+
+  /**
+   * @brief antiderivative that vanishes at low
+   */
+  [[nodiscard]] auto integral() const -> Chebyshev {
+    const auto n = degree();
+    auto c = [this](std::size_t k) { return k < coefficients_.size() ? coefficients_[k] : T{}; };
+
+    std::vector<T> res(n + 2);
+    const auto scale = (high_ - low_) / 2;
+    res[1] = (c(0) - c(2) / 2) * scale;
+    for (auto k = 2u; k <= n + 1; k++) res[k] = (c(k - 1) - c(k + 1)) / (2 * static_cast<T>(k)) * scale;
+
+    // T_k(-1) = (-1)^k
+    for (auto k = 1u; k <= n + 1; k++) res[0] -= k % 2 == 0 ? res[k] : -res[k];
+    return Chebyshev(low_, high_, std::move(res));
+  }
+
+  /**
+   * @brief integral over [low, high]
+   */
+  [[nodiscard]] auto integrate() const noexcept -> T {
+    auto res = T{};
+    for (auto k = 0u; k < coefficients_.size(); k += 2) res += coefficients_[k] * 2 / (1 - static_cast<T>(k * k));
+    return res * (high_ - low_) / 2;
+  }
+
+  /**
+   * @brief real roots in [low, high], sorted
+   */
+  [[nodiscard]] auto roots(ChebyshevOptions<T> const& options = {}) const -> std::vector<T> {
+    std::vector<T> res;
+    collectRoots(res, options);
+    std::ranges::sort(res);
+
+    // a root at a split point is found on both sides
+    const auto tolerance = std::sqrt(std::numeric_limits<T>::epsilon()) * (high_ - low_);
+    const auto [first, last] = std::ranges::unique(res, [tolerance](T a, T b) { return b - a <= tolerance; });
+    res.erase(first, last);
+    return res;
+  }
+
+  [[nodiscard]] auto degree() const noexcept -> std::size_t { return coefficients_.size() - 1; }
+  [[nodiscard]] auto coefficients() const noexcept -> std::span<const T> { return coefficients_; }
+  [[nodiscard]] auto low() const noexcept -> T { return low_; }
+  [[nodiscard]] auto high() const noexcept -> T { return high_; }
+};
+
+}  // namespace jr_numeric::interpolations
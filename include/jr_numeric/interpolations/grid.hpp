@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::interpolations {
+
+using concepts::FloatingPoint;
+
+enum class GridMethod {
+  KLinear,  // 2^D neighbours, continuous
+  KCubic,   // 4^D neighbours, cubic Hermite with finite difference slopes along every axis, C1
+};
+
+namespace implementation {
+
+/**
+ * @brief one axis of a rectilinear grid, uniform axes are located by index arithmetic, others by binary search
+ */
+template <FloatingPoint T>
+class GridAxis {
+  std::vector<T> x_;
+  std::vector<std::array<T, 3>> slopes_;
+  bool uniform_{};
+  T inverse_step_{};
+
+ public:
+  GridAxis() = default;
+
+  explicit GridAxis(std::vector<T> x) : x_(std::move(x)) {
+    const auto n = x_.size();
+    assert(n >= 2);
+    assert(std::ranges::is_sorted(x_) && std::ranges::adjacent_find(x_) == x_.end());
+
+    const auto step = (x_.back() - x_.front()) / static_cast<T>(n - 1);
+    const auto tolerance = 16 * std::numeric_limits<T>::epsilon() * std::max(std::abs(x_.front()), std::abs(x_.back()));
+    uniform_ = std::ranges::all_of(std::views::iota(std::size_t{0}, n), [&](std::size_t i) {
+      return std::abs(x_[i] - (x_.front() + static_cast<T>(i) * step)) <= tolerance;
+    });
+    inverse_step_ = 1 / step;
+
+    // slopes of the quadratic through three nodes, centered inside and one sided at the ends, second order everywhere
+    slopes_.resize(n);
+    if (n == 2) {
+      const auto g = 1 / (x_[1] - x_[0]);
+      slopes_[0] = slopes_[1] = {-g, g, T{}};
+      return;
+    }
+    for (auto k = 0u; k < n; k++) {
+      const auto start = slopeStart(k);
+      const auto h1 = x_[start + 1] - x_[start];
+      const auto h2 = x_[start + 2] - x_[start + 1];
+      const auto width = h1 + h2;
+      if (k == 0) {
+        slopes_[k] = {-(2 * h1 + h2) / (h1 * width), width / (h1 * h2), -h1 / (h2 * width)};
+      } else if (k == n - 1) {
+        slopes_[k] = {h2 / (h1 * width), -width / (h1 * h2), (h1 + 2 * h2) / (h2 * width)};
+      } else {
+        slopes_[k] = {-h2 / (h1 * width), (h2 - h1) / (h1 * h2), h1 / (h2 * width)};
+      }
+    }
+  }
+
+  // index of the cell [x_i, x_i+1] containing t, clamped to the end cells
+  [[nodiscard]] auto locate(T t) const noexcept -> std::size_t {
+    const auto last = x_.size() - 2;
+    if (uniform_) {
+      const auto s = (t - x_.front()) * inverse_step_;
+      return s <= 0 ? 0 : std::min(static_cast<std::size_t>(s), last);
+    }
+    const auto upper = std::ranges::upper_bound(x_, t);
+    return upper == x_.begin() ? 0 : std::min(static_cast<std::size_t>(upper - x_.begin()) - 1, last);
+  }
+
+  // first of the three nodes the slope at node k is taken from
+  [[nodiscard]] auto slopeStart(std::size_t k) const noexcept -> std::size_t {
+    return x_.size() < 3 ? 0 : std::min(k == 0 ? 0 : k - 1, x_.size() - 3);
+  }
+
+  // weights of the values at nodes slopeStart(k) .. slopeStart(k) + 2 in the slope at node k
+  [[nodiscard]] auto slope(std::size_t k) const noexcept -> std::array<T, 3> const& { return slopes_[k]; }
+
+  [[nodiscard]] auto operator[](std::size_t i) const noexcept -> T { return x_[i]; }
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return x_.size(); }
+};
+
+}  // namespace implementation
+
+/**
+ * @brief Tensor product interpolation of values on a D dimensional rectilinear grid.
+ *
+ * Values are stored in tiles of Tile^D points, so the neighbours of a query lie in one or a few tiles instead of being
+ * spread over D distant rows. Every query costs D axis lookups and a contraction of the 2^D or 4^D neighbours. Outside
+ * the grid the end cells are extrapolated.
+ */
+template <FloatingPoint T, std::size_t D, GridMethod Method = GridMethod::KLinear, std::size_t Tile = 4>
+class GridInterpolation {
+  static_assert(D >= 1 && Tile >= 1);
+
+  static constexpr std::size_t kStencil = Method == GridMethod::KLinear ? 2 : 4;
+
+  static constexpr auto power(std::size_t base) noexcept -> std::size_t {
+    auto res = std::size_t{1};
+    for (auto d = 0u; d < D; d++) res *= base;
+    return res;
+  }
+
+  static constexpr std::size_t kTileSize = power(Tile);
+  static constexpr std::size_t kNeighbours = power(kStencil);
+
+  std::array<implementation::GridAxis<T>, D> axes_;
+  std::array<std::size_t, D> tiles_;  // tiles along every axis
+  std::vector<T> values_;
+
+  [[nodiscard]] auto offset(std::array<std::size_t, D> const& index) const noexcept -> std::size_t {
+    auto tile = std::size_t{0}, local = std::size_t{0};
+    for (auto d = 0u; d < D; d++) {
+      tile = tile * tiles_[d] + index[d] / Tile;
+      local = local * Tile + index[d] % Tile;
+    }
+    return tile * kTileSize + local;
+  }
+
+  // weights of the kStencil values starting at node first, for the cell [x_i, x_i+1]
+  [[nodiscard]] auto weights(std::size_t d, std::size_t i, T t, std::size_t& first) const noexcept
+      -> std::array<T, kStencil> {
+    auto const& axis = axes_[d];
+    const auto h = axis[i + 1] - axis[i];
+    const auto s = (t - axis[i]) / h;
+
+    if constexpr (Method == GridMethod::KLinear) {
+      first = i;
+      return {1 - s, s};
+    } else {
+      // nodes i - 1 .. i + 2, the first and the last cell use the one sided slopes of their end node
+      first = i == 0 ? 0 : i - 1;
+
+      const auto h00 = (1 + 2 * s) * (1 - s) * (1 - s);
+      const auto h10 = s * (1 - s) * (1 - s) * h;
+      const auto h01 = s * s * (3 - 2 * s);
+      const auto h11 = s * s * (s - 1) * h;
+
+      std::array<T, 4> res{};
+      res[i - first] += h00;
+      res[i + 1 - first] += h01;
+      auto add = [&](std::size_t node, T w) {
+        const auto start = axis.slopeStart(node) - first;
+        auto const& m = axis.slope(node);
+        for (auto j = 0u; j < 3; j++) res[start + j] += w * m[j];
+      };
+      add(i, h10);
+      add(i + 1, h11);
+      return res;
+    }
+  }
+
+ public:
+  /**
+   * @param axes increasing node coordinates along every axis
+   * @param values row major, the last axis changes fastest
+   */
+  GridInterpolation(std::array<std::vector<T>, D> axes, std::span<const T> values) {
+    auto count = std::size_t{1}, points = std::size_t{1};
+    for (auto d = 0u; d < D; d++) {
+      axes_[d] = implementation::GridAxis<T>(std::move(axes[d]));
+      tiles_[d] = (axes_[d].size() + Tile - 1) / Tile;
+      count *= tiles_[d];
+      points *= axes_[d].size();
+    }
+    assert(values.size() == points);
+    values_.assign(count * kTileSize, T{});
+
+    std::array<std::size_t, D> index{};
+    for (const auto v : values) {
+      values_[offset(index)] = v;
+      for (auto d = D; d-- > 0;) {
+        if (++index[d] < axes_[d].size()) break;
+        index[d] = 0;
+      }
+    }
+  }
+
+  [[nodiscard]] auto operator()(std::array<T, D> const& x) const noexcept -> T {
+    std::array<std::array<T, kStencil>, D> w;
+    std::array<std::size_t, D> first;
+    for (auto d = 0u; d < D; d++) w[d] = weights(d, axes_[d].locate(x[d]), x[d], first[d]);
+
+    auto res = T{};
+    std::array<std::size_t, D> index;
+    for (auto k = 0u; k < kNeighbours; k++) {
+      auto weight = T{1};
+      auto rest = k;
+      for (auto d = D; d-- > 0;) {
+        const auto j = rest % kStencil;
+        rest /= kStencil;
+        weight *= w[d][j];
+        // the padding weight of a clamped stencil is 0, keep its index inside the grid
+        index[d] = std::min(first[d] + j, axes_[d].size() - 1);
+      }
+      if (weight != 0) res += weight * values_[offset(index)];
+    }
+    return res;
+  }
+
+  template <FloatingPoint... Ts>
+    requires(sizeof...(Ts) == D)
+  [[nodiscard]] auto operator()(Ts... x) const noexcept -> T {
+    return (*this)(std::array<T, D>{static_cast<T>(x)...});
+  }
+};
+
+}  // namespace jr_numeric::interpolations
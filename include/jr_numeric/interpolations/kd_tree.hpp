@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::interpolations {
+
+using concepts::FloatingPoint;
+
+/**
+ * @brief Balanced k-d tree over points in R^D, built in O(n log n).
+ *
+ * The tree is implicit: the points are reordered so that the median of every range is its node, split along the axis
+ * of the largest spread. A k nearest neighbour query takes O(log n) for well spread points and needs no allocations.
+ */
+template <FloatingPoint T, std::size_t D>
+class KdTree {
+ public:
+  using Point = std::array<T, D>;
+  using Neighbour = std::pair<T, std::size_t>;  // squared distance, index in the original points
+
+ private:
+  std::vector<Point> points_;       // in tree order
+  std::vector<std::size_t> index_;  // original index of points_[i]
+  std::vector<std::uint8_t> axis_;  // split axis of the node at i
+
+  static auto distanceSquared(Point const& a, Point const& b) noexcept -> T {
+    auto res = T{};
+    for (auto d = 0u; d < D; d++) res += (a[d] - b[d]) * (a[d] - b[d]);
+    return res;
+  }
+
+  // orders index_[begin, end) so that its median is the node, points_ are still in the original order here
+  auto build(std::size_t begin, std::size_t end) -> void {
+    if (end - begin <= 1) return;
+
+    auto axis = std::size_t{0};
+    auto spread = T{-1};
+    for (auto d = 0u; d < D; d++) {
+      auto low = std::numeric_limits<T>::max(), high = std::numeric_limits<T>::lowest();
+      for (auto i = begin; i < end; i++) {
+        low = std::min(low, points_[index_[i]][d]);
+        high = std::max(high, points_[index_[i]][d]);
+      }
+      if (high - low > spread) axis = d, spread = high - low;
+    }
+
+    const auto mid = begin + (end - begin) / 2;
+    std::nth_element(
+        index_.begin() + static_cast<std::ptrdiff_t>(begin),
+        index_.begin() + static_cast<std::ptrdiff_t>(mid),
+        index_.begin() + static_cast<std::ptrdiff_t>(end),
+        [&](std::size_t a, std::size_t b) { return points_[a][axis] < points_[b][axis]; });
+
+    axis_[mid] = static_cast<std::uint8_t>(axis);
+    build(begin, mid);
+    build(mid + 1, end);
+  }
+
+  auto search(Point const& query, std::size_t begin, std::size_t end, std::span<Neighbour> heap, std::size_t& found)
+      const noexcept -> void {
+    if (begin >= end) return;
+
+    const auto mid = begin + (end - begin) / 2;
+    const auto distance = distanceSquared(query, points_[mid]);
+    auto less = [](Neighbour const& a, Neighbour const& b) { return a.first < b.first; };
+
+    // max heap of the best candidates so far
+    if (found < heap.size()) {
+      heap[found++] = {distance, index_[mid]};
+      std::push_heap(heap.begin(), heap.begin() + static_cast<std::ptrdiff_t>(found), less);
+    } else if (distance < heap.front().first) {
+      std::pop_heap(heap.begin(), heap.end(), less);
+      heap.back() = {distance, index_[mid]};
+      std::push_heap(heap.begin(), heap.end(), less);
+    }
+
+    const auto axis = axis_[mid];
+    const auto difference = query[axis] - points_[mid][axis];
+    const auto near = difference < 0 ? std::pair{begin, mid} : std::pair{mid + 1, end};
+    const auto far = difference < 0 ? std::pair{mid + 1, end} : std::pair{begin, mid};
+
+    search(query, near.first, near.second, heap, found);
+    // the other side can only help when the splitting plane is closer than the worst candidate
+    if (found < heap.size() || difference * difference < heap.front().first) {
+      search(query, far.first, far.second, heap, found);
+    }
+  }
+
+ public:
+  explicit KdTree(std::vector<Point> points)
+      : points_(std::move(points)), index_(points_.size()), axis_(points_.size()) {
+    for (auto i = 0u; i < index_.size(); i++) index_[i] = i;
+    build(0, points_.size());
+
+    // tree order, so that a query walks through nearby memory
+    std::vector<Point> ordered(points_.size());
+    for (auto i = 0u; i < ordered.size(); i++) ordered[i] = points_[index_[i]];
+    points_ = std::move(ordered);
+  }
+
+  /**
+   * @brief the neighbours.size() points closest to query, sorted by distance
+   *
+   * @return number of neighbours found, less than neighbours.size() only for a smaller tree
+   */
+  auto nearest(Point const& query, std::span<Neighbour> neighbours) const noexcept -> std::size_t {
+    auto found = std::size_t{0};
+    search(query, 0, points_.size(), neighbours, found);
+    std::sort(neighbours.begin(), neighbours.begin() + static_cast<std::ptrdiff_t>(found));
+    return found;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return points_.size(); }
+};
+
+}  // namespace jr_numeric::interpolations
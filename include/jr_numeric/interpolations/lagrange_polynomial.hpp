@@ -3,6 +3,7 @@
 #include <fmt/printf.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <cmath>
@@ -23,28 +24,144 @@ struct LagrangePolynomial {
 
   SamplesVector samples_;
 
-  explicit LagrangePolynomial(SamplesVector samples) : samples_(std::move(samples)) {}
+  // barycentric weights 1 / prod_{k != j} (t_j - t_k), the differences are multiplied by weight_scale_ to stay clear
+  // of over/underflow, a common factor of all weights that cancels in the barycentric formula
+  std::vector<double> weights_;
+  double weight_scale_{1};  // 4 / (max - min) of the parameters when the weights were last computed from scratch
 
-  [[nodiscard]] auto neville(const double t) const noexcept -> double {
-    using CoeffVec = std::vector<double>;
-    CoeffVec values(samples_.size());
-    rg::transform(samples_, values.begin(), &SamplesVector::value_type::second);
+  explicit LagrangePolynomial(SamplesVector samples) : samples_(std::move(samples)) { computeWeights(); }
 
-    auto merges = values.size();
+  /**
+   * @brief weight_scale_ from the current range and the weights from scratch, O(n^2)
+   */
+  auto computeWeights() -> void {
+    if (samples_.size() > 1) {
+      auto [low, high] = rg::minmax(samples_ | std::views::keys);
+      weight_scale_ = 4 / (high - low);
+    }
+
+    weights_.assign(samples_.size(), 1.);
+    for (auto j = 0u; j < samples_.size(); j++) {
+      for (auto k = 0u; k < samples_.size(); k++) {
+        if (j != k) weights_[j] *= weight_scale_ * (samples_[j].first - samples_[k].first);
+      }
+    }
+    for (auto& w : weights_) w = 1 / w;
+  }
+
+  /**
+   * @brief appends a sample and updates the barycentric weights in O(n), parameters have to stay distinct
+   *
+   * Once the parameters span more than twice the range weight_scale_ was taken from, the weights are recomputed with a
+   * new scale in O(n^2). That happens each time the range doubles, so pushes stay O(n) amortized.
+   */
+  auto push(double t, double value) -> void {
+    auto rescale = samples_.empty();
+    if (!rescale) {
+      auto [low, high] = rg::minmax(samples_ | std::views::keys);
+      const auto scaled_range = weight_scale_ * (std::max(high, t) - std::min(low, t));
+      rescale = scaled_range < 2 || scaled_range > 8;
+    }
+    if (rescale) {
+      samples_.emplace_back(t, value);
+      computeWeights();
+      return;
+    }
+
+    auto weight = 1.;
+    for (auto j = 0u; j < samples_.size(); j++) {
+      const auto difference = weight_scale_ * (samples_[j].first - t);
+      assert(difference != 0);
+      weights_[j] /= difference;
+      weight *= -difference;
+    }
+    samples_.emplace_back(t, value);
+    weights_.push_back(1 / weight);
+  }
+
+  // t values evaluated together by the batched neville, the inner loop runs over them
+  static constexpr std::size_t kNevilleLanes = 8;
+
+  /**
+   * @brief Neville's scheme updated in place on a caller owned buffer of at least samples_.size() elements
+   */
+  [[nodiscard]] auto neville(const double t, std::span<double> scratch) const noexcept -> double {
+    const auto n = samples_.size();
+    assert(n > 0 && scratch.size() >= n);
+
+    for (auto j = 0u; j < n; j++) scratch[j] = samples_[j].second;
+
+    // after step m, scratch[j] interpolates samples j..j+m
+    for (auto m = 1u; m < n; m++) {
+      for (auto j = 0u; j + m < n; j++) {
+        const auto t_j = samples_[j].first;
+        const auto t_jm = samples_[j + m].first;
+        scratch[j] = ((t_jm - t) * scratch[j] + (t - t_j) * scratch[j + 1]) / (t_jm - t_j);
+      }
+    }
+
+    return scratch[0];
+  }
 
-    for (auto i = 0u; i < merges; i++) {
-      CoeffVec tmp(samples_.size() - 1);
-      for (auto j = 0u; j < values.size() - 1; j++) {
-        tmp[j] = ((t - samples_[j].first) * values[j + 1] - (t - samples_[j + 1].first) * values[j + 1]) /
-                 (samples_[j + i + 1].first - samples_[j].first);
+  [[nodiscard]] auto neville(const double t) const -> double {
+    std::vector<double> scratch(samples_.size());
+    return neville(t, scratch);
+  }
+
+  /**
+   * @brief Neville's scheme for every t, kNevilleLanes points at a time so that the updates vectorize
+   *
+   * @param scratch at least kNevilleLanes * samples_.size() elements, no allocation happens inside
+   */
+  auto neville(std::span<const double> t, std::span<double> out, std::span<double> scratch) const noexcept -> void {
+    constexpr auto kLanes = kNevilleLanes;
+    const auto n = samples_.size();
+    assert(n > 0 && out.size() >= t.size() && scratch.size() >= kLanes * n);
+
+    for (auto begin = std::size_t{0}; begin < t.size(); begin += kLanes) {
+      // a partial last block repeats its last point
+      std::array<double, kLanes> lanes;
+      for (auto l = 0u; l < kLanes; l++) lanes[l] = t[std::min(begin + l, t.size() - 1)];
+
+      for (auto j = 0u; j < n; j++) {
+        for (auto l = 0u; l < kLanes; l++) scratch[j * kLanes + l] = samples_[j].second;
       }
 
-      values = std::move(tmp);
+      for (auto m = 1u; m < n; m++) {
+        for (auto j = 0u; j + m < n; j++) {
+          const auto t_j = samples_[j].first;
+          const auto t_jm = samples_[j + m].first;
+          const auto inverse = 1 / (t_jm - t_j);
+          auto* current = &scratch[j * kLanes];
+          const auto* next = &scratch[(j + 1) * kLanes];
+          for (auto l = 0u; l < kLanes; l++) {
+            current[l] = ((t_jm - lanes[l]) * current[l] + (lanes[l] - t_j) * next[l]) * inverse;
+          }
+        }
+      }
+
+      for (auto l = 0u; l < kLanes && begin + l < t.size(); l++) out[begin + l] = scratch[l];
     }
+  }
 
-    assert(!values.empty());
+  /**
+   * @brief second (true) barycentric formula, O(n) per point and stable for any distinct nodes
+   */
+  [[nodiscard]] auto barycentric(const double t) const noexcept -> double {
+    assert(weights_.size() == samples_.size());
+
+    auto numerator = double{};
+    auto denominator = double{};
+    for (auto j = 0u; j < samples_.size(); j++) {
+      const auto difference = t - samples_[j].first;
+      if (difference == 0) return samples_[j].second;
+
+      const auto term = weights_[j] / difference;
+      numerator += term * samples_[j].second;
+      denominator += term;
+    }
 
-    return values[0];
+    return numerator / denominator;
   }
 
   [[nodiscard]] auto interpolate(const double t) const noexcept -> double {
@@ -69,8 +186,12 @@ struct LagrangePolynomial {
 enum class Method {
   KNeville,
   KNaive,
+  KBarycentric,
 };
 
+/**
+ * @brief materializes resulotion points of the curve, see sampled in sampling.hpp for a lazy view of the same points
+ */
 [[nodiscard]] inline auto generate(LagrangePolynomial const& pol, std::size_t resulotion, Method const method) noexcept
     -> auto{
   auto const& samples = pol.samples_;
@@ -79,12 +200,28 @@ enum class Method {
 
   LagrangePolynomial::SamplesVector interpolated_values(resulotion);
 
-  auto arg = samples.front().first;
+  // from the index, a running sum would drift
+  for (auto i = 0u; i < resulotion; i++) {
+    interpolated_values[i].first = samples.front().first + static_cast<double>(i) * diff;
+  }
+
+  if (method == Method::KNeville) {
+    // one scratch buffer and one block of arguments serve the whole curve
+    constexpr auto kLanes = LagrangePolynomial::kNevilleLanes;
+    std::vector<double> scratch(kLanes * samples.size());
+    std::array<double, kLanes> t;
+    std::array<double, kLanes> res;
+    for (auto begin = std::size_t{0}; begin < resulotion; begin += kLanes) {
+      const auto count = std::min(kLanes, resulotion - begin);
+      for (auto l = 0u; l < count; l++) t[l] = interpolated_values[begin + l].first;
+      pol.neville(std::span<const double>(t.data(), count), res, scratch);
+      for (auto l = 0u; l < count; l++) interpolated_values[begin + l].second = res[l];
+    }
+    return interpolated_values;
+  }
 
   for (auto& [t, res] : interpolated_values) {
-    t = arg;
-    res = method == Method::KNeville ? pol.neville(t) : pol.interpolate(t);
-    arg += diff;
+    res = method == Method::KNaive ? pol.interpolate(t) : pol.barycentric(t);
   }
 
   return interpolated_values;
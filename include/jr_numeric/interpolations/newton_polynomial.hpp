@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::interpolations {
+
+using concepts::FloatingPoint;
+
+/**
+ * @brief Interpolating polynomial in Newton form for samples that arrive one at a time.
+ *
+ * Only the newest diagonal of the divided difference table is kept, differences_[k] = f[x_n-k, ..., x_n]. These are the
+ * Newton coefficients for the nodes taken newest first, so push is O(n) and dropping the oldest node is dropping the
+ * last coefficient. With a window the interpolant slides over the stream with a fixed degree of window - 1.
+ */
+template <FloatingPoint T>
+class NewtonPolynomial {
+  std::vector<T> x_;  // oldest first
+  std::vector<T> differences_;
+  std::size_t window_;
+
+ public:
+  /**
+   * @param window number of newest samples kept, 0 keeps all of them
+   */
+  explicit NewtonPolynomial(std::size_t window = 0) : window_(window) {
+    if (window_ > 0) {
+      x_.reserve(window_ + 1);
+      differences_.reserve(window_ + 1);
+    }
+  }
+
+  /**
+   * @param samples (x, y) pairs, e.g. LagrangePolynomial::SamplesVector
+   */
+  template <std::ranges::input_range Samples>
+  explicit NewtonPolynomial(Samples const& samples, std::size_t window = 0) : NewtonPolynomial(window) {
+    for (const auto& [x, y] : samples) push(static_cast<T>(x), static_cast<T>(y));
+  }
+
+  /**
+   * @brief adds a sample in O(n), x has to differ from the nodes in the window
+   */
+  auto push(T x, T y) -> void {
+    const auto n = x_.size();
+    auto carry = y;  // f[x_n-k+1, ..., x] after step k
+    for (auto k = 0u; k < n; k++) {
+      const auto previous = differences_[k];
+      differences_[k] = carry;
+      assert(x != x_[n - 1 - k]);
+      carry = (carry - previous) / (x - x_[n - 1 - k]);
+    }
+    differences_.push_back(carry);
+    x_.push_back(x);
+
+    if (window_ > 0 && x_.size() > window_) {
+      x_.erase(x_.begin());
+      differences_.pop_back();
+    }
+  }
+
+  /**
+   * @brief nested multiplication from the oldest node in the window, O(n)
+   */
+  [[nodiscard]] auto operator()(T t) const noexcept -> T {
+    const auto n = x_.size();
+    if (n == 0) return T{};
+
+    auto res = differences_[n - 1];
+    for (auto k = n - 1; k-- > 0;) res = res * (t - x_[n - 1 - k]) + differences_[k];
+    return res;
+  }
+
+  auto clear() noexcept -> void {
+    x_.clear();
+    differences_.clear();
+  }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return x_.size(); }
+  [[nodiscard]] auto nodes() const noexcept -> std::span<const T> { return x_; }
+  [[nodiscard]] auto differences() const noexcept -> std::span<const T> { return differences_; }
+};
+
+}  // namespace jr_numeric::interpolations
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/algebra/lu.hpp"
+#include "jr_numeric/algebra/matrix.hpp"
+#include "jr_numeric/interpolations/kd_tree.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::interpolations {
+
+using concepts::FloatingPoint;
+
+enum class RbfKernel {
+  KCubic,         // r^3, no shape parameter
+  KThinPlate,     // r^2 log r, no shape parameter
+  KGaussian,      // exp(-(shape r)^2)
+  KMultiquadric,  // sqrt(1 + (shape r)^2)
+};
+
+/**
+ * @brief Local radial basis function interpolation of scattered data in R^D.
+ *
+ * A query interpolates only its K nearest samples, found by a k-d tree in O(log n), with the kernel plus a linear
+ * polynomial. That is a (K + D + 1) square system solved on the stack, so a query costs O(log n + K^3) regardless of
+ * the number of samples instead of one dense O(n^3) solve. Distances of the polyharmonic kernels are taken relative to
+ * the neighbourhood radius, which keeps the small systems well conditioned.
+ */
+template <FloatingPoint T, std::size_t D, std::size_t K = 16>
+class RbfInterpolation {
+  static constexpr std::size_t kSystem = K + D + 1;
+
+  using Point = std::array<T, D>;
+
+  std::vector<Point> points_;
+  std::vector<T> values_;
+  KdTree<T, D> tree_;
+  RbfKernel kernel_;
+  T shape_;
+
+  [[nodiscard]] auto phi(T r) const noexcept -> T {
+    switch (kernel_) {
+      case RbfKernel::KCubic:
+        return r * r * r;
+      case RbfKernel::KThinPlate:
+        return r > 0 ? r * r * std::log(r) : T{};
+      case RbfKernel::KGaussian:
+        return std::exp(-(shape_ * r) * (shape_ * r));
+      case RbfKernel::KMultiquadric:
+        return std::sqrt(1 + (shape_ * r) * (shape_ * r));
+    }
+    return T{};
+  }
+
+  static auto distance(Point const& a, Point const& b) noexcept -> T {
+    auto res = T{};
+    for (auto d = 0u; d < D; d++) res += (a[d] - b[d]) * (a[d] - b[d]);
+    return std::sqrt(res);
+  }
+
+ public:
+  /**
+   * @param points distinct sample positions, at least K of them
+   * @param shape only for KGaussian and KMultiquadric, in units of 1 / distance
+   */
+  RbfInterpolation(std::vector<Point> points, std::vector<T> values, RbfKernel kernel = RbfKernel::KCubic, T shape = 1)
+      : points_(points), values_(std::move(values)), tree_(std::move(points)), kernel_(kernel), shape_(shape) {
+    assert(points_.size() == values_.size() && points_.size() >= K);
+  }
+
+  [[nodiscard]] auto operator()(Point const& x) const noexcept -> T {
+    std::array<typename KdTree<T, D>::Neighbour, K> neighbours;
+    tree_.nearest(x, neighbours);
+
+    // polynomial columns are centered at x, so the polynomial part of the result is its constant term
+    const auto polyharmonic = kernel_ == RbfKernel::KCubic || kernel_ == RbfKernel::KThinPlate;
+    const auto radius = std::sqrt(neighbours.back().first);
+    const auto scale = polyharmonic && radius > 0 ? 1 / radius : T{1};
+    const auto poly_scale = radius > 0 ? 1 / radius : T{1};
+
+    algebra::Matrix<kSystem, kSystem, T> a;
+    std::array<T, kSystem> rhs{};
+    for (auto i = 0u; i < K; i++) {
+      const auto& p = points_[neighbours[i].second];
+      for (auto j = 0u; j < K; j++) a[i][j] = phi(scale * distance(p, points_[neighbours[j].second]));
+
+      a[i][K] = a[K][i] = 1;
+      for (auto d = 0u; d < D; d++) a[i][K + 1 + d] = a[K + 1 + d][i] = (p[d] - x[d]) * poly_scale;
+      rhs[i] = values_[neighbours[i].second];
+    }
+    for (auto i = K; i < kSystem; i++) {
+      for (auto j = K; j < kSystem; j++) a[i][j] = T{};
+    }
+
+    const auto lu = algebra::luFactorize(a);
+    // coincident or degenerate neighbourhoods, e.g. all on a line in 2d
+    if (lu.singular_) return values_[neighbours.front().second];
+
+    const auto w = algebra::luSolve(lu, rhs);
+    auto res = w[K];
+    for (auto i = 0u; i < K; i++) res += w[i] * phi(scale * std::sqrt(neighbours[i].first));
+    return res;
+  }
+
+  template <FloatingPoint... Ts>
+    requires(sizeof...(Ts) == D)
+  [[nodiscard]] auto operator()(Ts... x) const noexcept -> T {
+    return (*this)(Point{static_cast<T>(x)...});
+  }
+};
+
+}  // namespace jr_numeric::interpolations
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/interpolations/lagrange_polynomial.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::interpolations {
+
+using concepts::FloatingPoint;
+
+/**
+ * @brief Lazy view of the (t, function(t)) pairs for t = low + i * (high - low) / resolution, i in [0, resolution).
+ *
+ * Points are computed when they are read, so memory does not grow with the resolution, and every t comes from its
+ * index instead of a running sum that drifts. The view is random access and sized, std::views::drop and take slice
+ * it and chunk splits it for parallel consumers. It refers to function, which has to outlive it.
+ */
+template <FloatingPoint T, typename Function>
+  requires std::is_invocable_r_v<T, Function const&, T>
+auto sampled(Function const& function, T low, T high, std::size_t resolution) {
+  const auto step = (high - low) / static_cast<T>(resolution);
+  return std::views::iota(std::size_t{0}, resolution) |
+         std::views::transform([&function, low, step](std::size_t i) {
+           const auto t = low + static_cast<T>(i) * step;
+           return std::pair<T, T>{t, static_cast<T>(function(t))};
+         });
+}
+
+namespace implementation {
+
+// evaluates pol at t = low + i * step, owns the scratch of neville so that no point allocates
+struct LagrangeSample {
+  LagrangePolynomial const* pol_;
+  double low_;
+  double step_;
+  Method method_;
+  mutable std::vector<double> scratch_;
+
+  auto operator()(std::size_t i) const -> std::pair<double, double> {
+    const auto t = low_ + static_cast<double>(i) * step_;
+    switch (method_) {
+      case Method::KNeville:
+        return {t, pol_->neville(t, scratch_)};
+      case Method::KNaive:
+        return {t, pol_->interpolate(t)};
+      case Method::KBarycentric:
+        break;
+    }
+    return {t, pol_->barycentric(t)};
+  }
+};
+
+}  // namespace implementation
+
+/**
+ * @brief the same points as generate, evaluated on demand
+ *
+ * KNeville works on a buffer owned by the view, allocated once here. Every copy of the view, e.g. every chunk, has its
+ * own, but one view must not be read by several threads at once.
+ */
+inline auto sampled(LagrangePolynomial const& pol, std::size_t resolution, Method method) {
+  auto const& samples = pol.samples_;
+  const auto step = (samples.back().first - samples.front().first) / static_cast<double>(resolution);
+  auto scratch = std::vector<double>(method == Method::KNeville ? samples.size() : 0);
+  return std::views::iota(std::size_t{0}, resolution) |
+         std::views::transform(
+             implementation::LagrangeSample{&pol, samples.front().first, step, method, std::move(scratch)});
+}
+
+/**
+ * @brief part index of count nearly equal, contiguous parts of a random access view, e.g. one per thread
+ */
+template <std::ranges::random_access_range Range>
+  requires std::ranges::sized_range<Range> && std::ranges::viewable_range<Range>
+auto chunk(Range&& range, std::size_t count, std::size_t index) {
+  assert(count > 0 && index < count);
+  const auto n = static_cast<std::size_t>(std::ranges::size(range));
+  const auto begin = index * (n / count) + std::min(index, n % count);
+  const auto end = (index + 1) * (n / count) + std::min(index + 1, n % count);
+  return std::views::all(std::forward<Range>(range)) | std::views::drop(begin) | std::views::take(end - begin);
+}
+
+}  // namespace jr_numeric::interpolations
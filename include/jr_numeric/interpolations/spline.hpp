@@ -0,0 +1,238 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/algebra/tridiagonal.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::interpolations {
+
+using concepts::FloatingPoint;
+
+enum class SplineKind {
+  KNatural,   // zero second derivative at both ends
+  KClamped,   // given first derivatives at both ends
+  KNotAKnot,  // continuous third derivative at the second and the second to last knot
+  KPchip,     // monotone piecewise cubic Hermite of Fritsch and Carlson, only C1
+  KAkima,     // local slopes insensitive to outliers, only C1
+};
+
+namespace implementation {
+
+// slopes of the C2 splines from the tridiagonal system for the first derivatives
+template <FloatingPoint T>
+auto splineSlopes(std::span<const T> h, std::span<const T> delta, SplineKind kind, std::pair<T, T> ends)
+    -> std::vector<T> {
+  const auto n = h.size() + 1;
+  std::vector<T> lower(n), diagonal(n), upper(n), res(n);
+
+  for (auto i = 1u; i + 1 < n; i++) {
+    lower[i] = h[i];
+    diagonal[i] = 2 * (h[i - 1] + h[i]);
+    upper[i] = h[i - 1];
+    res[i] = 3 * (h[i] * delta[i - 1] + h[i - 1] * delta[i]);
+  }
+
+  switch (kind) {
+    case SplineKind::KClamped:
+      diagonal[0] = diagonal[n - 1] = 1;
+      res[0] = ends.first;
+      res[n - 1] = ends.second;
+      break;
+    case SplineKind::KNotAKnot: {
+      const auto s0 = h[0] + h[1];
+      diagonal[0] = h[1];
+      upper[0] = s0;
+      res[0] = ((h[0] + 2 * s0) * h[1] * delta[0] + h[0] * h[0] * delta[1]) / s0;
+
+      const auto s1 = h[n - 2] + h[n - 3];
+      lower[n - 1] = s1;
+      diagonal[n - 1] = h[n - 3];
+      res[n - 1] = (h[n - 2] * h[n - 2] * delta[n - 3] + (2 * s1 + h[n - 2]) * h[n - 3] * delta[n - 2]) / s1;
+      break;
+    }
+    default:
+      diagonal[0] = diagonal[n - 1] = 2;
+      upper[0] = lower[n - 1] = 1;
+      res[0] = 3 * delta[0];
+      res[n - 1] = 3 * delta[n - 2];
+      break;
+  }
+
+  algebra::solveTridiagonal<T>(lower, diagonal, upper, res);
+  return res;
+}
+
+template <FloatingPoint T>
+auto pchipSlopes(std::span<const T> h, std::span<const T> delta) -> std::vector<T> {
+  const auto n = h.size() + 1;
+  std::vector<T> res(n);
+
+  for (auto i = 1u; i + 1 < n; i++) {
+    if (delta[i - 1] * delta[i] <= 0) continue;
+    // weighted harmonic mean keeps the interpolant monotone where the data is
+    const auto w1 = 2 * h[i] + h[i - 1];
+    const auto w2 = h[i] + 2 * h[i - 1];
+    res[i] = (w1 + w2) / (w1 / delta[i - 1] + w2 / delta[i]);
+  }
+
+  // one sided three point estimates, limited so that the end intervals stay monotone too
+  auto end = [](T h0, T h1, T d0, T d1) {
+    auto d = ((2 * h0 + h1) * d0 - h0 * d1) / (h0 + h1);
+    if (std::signbit(d) != std::signbit(d0) || d0 == 0) return T{};
+    if (std::signbit(d0) != std::signbit(d1) && std::abs(d) > 3 * std::abs(d0)) return 3 * d0;
+    return d;
+  };
+  res[0] = end(h[0], h[1], delta[0], delta[1]);
+  res[n - 1] = end(h[n - 2], h[n - 3], delta[n - 2], delta[n - 3]);
+  return res;
+}
+
+template <FloatingPoint T>
+auto akimaSlopes(std::span<const T> delta) -> std::vector<T> {
+  const auto n = delta.size() + 1;
+  const auto last = static_cast<std::ptrdiff_t>(delta.size()) - 1;
+
+  // two extra secant slopes on each side, extrapolated linearly
+  auto m = [&](std::ptrdiff_t k) -> T {
+    if (k < 0) {
+      const auto m0 = delta[0], m1 = last >= 1 ? delta[1] : delta[0];
+      return k == -1 ? 2 * m0 - m1 : 3 * m0 - 2 * m1;
+    }
+    if (k > last) {
+      const auto m0 = delta[last], m1 = last >= 1 ? delta[last - 1] : delta[last];
+      return k == last + 1 ? 2 * m0 - m1 : 3 * m0 - 2 * m1;
+    }
+    return delta[k];
+  };
+
+  std::vector<T> res(n);
+  for (auto i = std::ptrdiff_t{0}; i < static_cast<std::ptrdiff_t>(n); i++) {
+    const auto w1 = std::abs(m(i + 1) - m(i));
+    const auto w2 = std::abs(m(i - 1) - m(i - 2));
+    res[i] = w1 + w2 > 0 ? (w1 * m(i - 1) + w2 * m(i)) / (w1 + w2) : (m(i - 1) + m(i)) / 2;
+  }
+  return res;
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Piecewise cubic interpolation of tabulated data, built in O(n).
+ *
+ * Every interval keeps the four coefficients of its cubic in t - x_i next to each other, so a lookup touches one
+ * knot search and one 4 element block. Knots found to be uniform are located by index arithmetic in O(1), otherwise by
+ * binary search. Outside of [x_0, x_n-1] the end cubics are extrapolated.
+ */
+template <FloatingPoint T>
+class CubicSpline {
+  std::vector<T> x_;
+  std::vector<std::array<T, 4>> coefficients_;  // y_i, y'_i, y''_i / 2, y'''_i / 6 on interval i
+  bool uniform_{};
+  T inverse_step_{};
+
+ public:
+  /**
+   * @param x increasing knots, at least 2, at least 4 for KNotAKnot
+   * @param ends first derivatives at x_0 and x_n-1, KClamped only
+   */
+  template <std::ranges::random_access_range X, std::ranges::random_access_range Y>
+  CubicSpline(X const& x, Y const& y, SplineKind kind = SplineKind::KNatural, std::pair<T, T> ends = {})
+      : x_(std::ranges::begin(x), std::ranges::end(x)) {
+    const auto n = x_.size();
+    assert(n >= 2 && static_cast<std::size_t>(std::ranges::size(y)) == n);
+    assert(kind != SplineKind::KNotAKnot || n >= 4);
+
+    std::vector<T> h(n - 1), delta(n - 1);
+    for (auto i = 0u; i + 1 < n; i++) {
+      h[i] = x_[i + 1] - x_[i];
+      assert(h[i] > 0);
+      delta[i] = (static_cast<T>(y[i + 1]) - static_cast<T>(y[i])) / h[i];
+    }
+
+    std::vector<T> slopes;
+    if (n == 2 && kind != SplineKind::KClamped) {
+      slopes.assign(2, delta[0]);
+    } else if (kind == SplineKind::KPchip) {
+      slopes = n == 2 ? std::vector<T>(2, delta[0]) : implementation::pchipSlopes<T>(h, delta);
+    } else if (kind == SplineKind::KAkima) {
+      slopes = implementation::akimaSlopes<T>(delta);
+    } else {
+      slopes = implementation::splineSlopes<T>(h, delta, kind, ends);
+    }
+
+    // cubic Hermite form on every interval
+    coefficients_.resize(n - 1);
+    for (auto i = 0u; i + 1 < n; i++) {
+      const auto d0 = slopes[i], d1 = slopes[i + 1];
+      coefficients_[i] = {
+          static_cast<T>(y[i]),
+          d0,
+          (3 * delta[i] - 2 * d0 - d1) / h[i],
+          (d0 + d1 - 2 * delta[i]) / (h[i] * h[i]),
+      };
+    }
+
+    const auto step = (x_.back() - x_.front()) / static_cast<T>(n - 1);
+    const auto tolerance = 16 * std::numeric_limits<T>::epsilon() * std::max(std::abs(x_.front()), std::abs(x_.back()));
+    uniform_ = std::ranges::all_of(std::views::iota(std::size_t{0}, n), [&](std::size_t i) {
+      return std::abs(x_[i] - (x_.front() + static_cast<T>(i) * step)) <= tolerance;
+    });
+    inverse_step_ = 1 / step;
+  }
+
+  /**
+   * @brief index of the interval used for t, clamped to the end intervals
+   */
+  [[nodiscard]] auto interval(T t) const noexcept -> std::size_t {
+    const auto last = coefficients_.size() - 1;
+    if (uniform_) {
+      const auto s = (t - x_.front()) * inverse_step_;
+      return s <= 0 ? 0 : std::min(static_cast<std::size_t>(s), last);
+    }
+    const auto upper = std::ranges::upper_bound(x_, t);
+    return upper == x_.begin() ? 0 : std::min(static_cast<std::size_t>(upper - x_.begin()) - 1, last);
+  }
+
+  [[nodiscard]] auto operator()(T t) const noexcept -> T {
+    const auto i = interval(t);
+    const auto& [a, b, c, d] = coefficients_[i];
+    const auto s = t - x_[i];
+    return a + s * (b + s * (c + s * d));
+  }
+
+  [[nodiscard]] auto derivative(T t) const noexcept -> T {
+    const auto i = interval(t);
+    const auto& [a, b, c, d] = coefficients_[i];
+    const auto s = t - x_[i];
+    return b + s * (2 * c + s * 3 * d);
+  }
+
+  [[nodiscard]] auto secondDerivative(T t) const noexcept -> T {
+    const auto i = interval(t);
+    const auto& [a, b, c, d] = coefficients_[i];
+    return 2 * c + 6 * d * (t - x_[i]);
+  }
+
+  /**
+   * @brief out[k] = spline(t[k]), without allocations
+   */
+  auto evaluate(std::span<const T> t, std::span<T> out) const noexcept -> void {
+    assert(out.size() >= t.size());
+    for (auto k = 0u; k < t.size(); k++) out[k] = (*this)(t[k]);
+  }
+
+  [[nodiscard]] auto uniform() const noexcept -> bool { return uniform_; }
+  [[nodiscard]] auto knots() const noexcept -> std::span<const T> { return x_; }
+};
+
+}  // namespace jr_numeric::interpolations
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include "jr_numeric/interpolations/chebyshev.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::interpolations {
+
+using concepts::FloatingPoint;
+
+template <FloatingPoint T>
+struct TabulationOptions {
+  T tolerance_ = std::sqrt(std::numeric_limits<T>::epsilon());  // absolute, estimated from the last two coefficients
+  std::size_t max_depth_ = 16;                                   // a segment is at least (high - low) / 2^max_depth_
+};
+
+/**
+ * @brief Precomputed piecewise Chebyshev table of an expensive R1RealFunction on [low, high].
+ *
+ * The domain is bisected adaptively until a Degree interpolant of every segment meets the tolerance, so smooth parts
+ * take few segments and sharp features many. A uniform index over the finest level maps t to its segment in O(1), and
+ * each segment keeps its coefficients contiguous, so a lookup is one index read, one segment read and a Clenshaw
+ * recurrence. It is itself an R1RealFunction, integrals and root finders take it in place of the original.
+ */
+template <FloatingPoint T, std::size_t Degree = 8>
+class TabulatedFunction {
+  static_assert(Degree >= 2 && (Degree & (Degree - 1)) == 0, "the coefficients come from a power of two FFT");
+
+  struct Segment {
+    T center_;
+    T inverse_half_width_;
+    std::array<T, Degree + 1> coefficients_;
+  };
+
+  T low_;
+  T high_;
+  T inverse_cell_;  // cells of the finest level per unit of t
+  std::vector<Segment> segments_;
+  std::vector<std::uint32_t> index_;  // segment of every cell of the finest level
+
+  template <typename Function>
+  static auto fit(Function const& function, T low, T high) -> Segment {
+    std::array<T, Degree + 1> values;
+    for (auto k = 0u; k <= Degree; k++) {
+      const auto x = std::cos(std::numbers::pi_v<T> * static_cast<T>(k) / Degree);
+      values[k] = function((low + high) / 2 + (high - low) / 2 * x);
+    }
+    const auto coefficients = implementation::chebyshevCoefficients<T>(values);
+
+    auto res = Segment{(low + high) / 2, 2 / (high - low), {}};
+    std::ranges::copy(coefficients, res.coefficients_.begin());
+    return res;
+  }
+
+  // depth first, so segments_ is ordered by position
+  template <typename Function>
+  auto refine(
+      Function const& function,
+      T low,
+      T high,
+      std::size_t depth,
+      TabulationOptions<T> const& options,
+      std::vector<std::size_t>& depths) -> void {
+    auto segment = fit(function, low, high);
+    const auto error = std::abs(segment.coefficients_[Degree - 1]) + std::abs(segment.coefficients_[Degree]);
+    if (error <= options.tolerance_ || depth == options.max_depth_) {
+      segments_.push_back(segment);
+      depths.push_back(depth);
+      return;
+    }
+    const auto middle = (low + high) / 2;
+    refine(function, low, middle, depth + 1, options, depths);
+    refine(function, middle, high, depth + 1, options, depths);
+  }
+
+ public:
+  template <concepts::R1RealFunction Function>
+  TabulatedFunction(Function const& function, T low, T high, TabulationOptions<T> const& options = {})
+      : low_(low), high_(high) {
+    assert(low < high);
+
+    std::vector<std::size_t> depths;
+    refine(function, low, high, 0, options, depths);
+
+    const auto finest = std::ranges::max(depths);
+    index_.reserve(std::size_t{1} << finest);
+    for (auto s = 0u; s < segments_.size(); s++) index_.insert(index_.end(), std::size_t{1} << (finest - depths[s]), s);
+    inverse_cell_ = static_cast<T>(index_.size()) / (high - low);
+  }
+
+  /**
+   * @brief value of the table, t outside [low, high] extrapolates the end segments
+   */
+  [[nodiscard]] auto operator()(T t) const noexcept -> T {
+    const auto s = (t - low_) * inverse_cell_;
+    const auto cell = s <= 0 ? 0 : std::min(static_cast<std::size_t>(s), index_.size() - 1);
+    const auto& segment = segments_[index_[cell]];
+
+    const auto x = (t - segment.center_) * segment.inverse_half_width_;
+    auto b1 = T{}, b2 = T{};
+    for (auto k = Degree; k > 0; k--) {
+      const auto b = segment.coefficients_[k] + 2 * x * b1 - b2;
+      b2 = b1;
+      b1 = b;
+    }
+    return segment.coefficients_[0] + x * b1 - b2;
+  }
+
+  [[nodiscard]] auto segments() const noexcept -> std::size_t { return segments_.size(); }
+  [[nodiscard]] auto low() const noexcept -> T { return low_; }
+  [[nodiscard]] auto high() const noexcept -> T { return high_; }
+};
+
+}  // namespace jr_numeric::interpolations
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "jr_numeric/ode/utils.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+namespace jr_numeric::ode {
+
+namespace implementation {
+
+template <typename Solver>
+struct SolverTraits;
+
+template <template <typename, std::size_t> typename Solver, FloatingPoint T, std::size_t N>
+struct SolverTraits<Solver<T, N>> {
+  using ValueType = T;
+  static constexpr std::size_t kDimension = N;
+};
+
+}  // namespace implementation
+
+/**
+ * @brief Integrates the same system from t0 to t1 for every initial state, results are written to out.
+ *
+ * The states are split into contiguous chunks, one per thread, and every chunk reuses a single Solver instance as its
+ * workspace. Solver is any adaptive solver of this module, e.g. DormandPrince<T, N> or Rosenbrock23<T, N>.
+ */
+template <
+    typename Solver,
+    typename Function,
+    typename T = typename implementation::SolverTraits<Solver>::ValueType,
+    std::size_t N = implementation::SolverTraits<Solver>::kDimension>
+  requires OdeSystem<Function, T, N>
+auto integrateBatch(
+    Function const& system,
+    std::type_identity_t<std::span<const State<T, N>>> initial,
+    std::type_identity_t<T> t0,
+    std::type_identity_t<T> t1,
+    std::type_identity_t<std::span<Solution<T, N>>> out,
+    std::type_identity_t<Options<T>> const& options = {},
+    std::size_t threads = utils::hardwareThreads()) -> void {
+  assert(out.size() >= initial.size());
+
+  utils::parallelChunks(initial.size(), threads, [&](std::size_t, std::size_t begin, std::size_t end) {
+    auto solver = Solver{};
+    for (auto i = begin; i < end; i++) out[i] = solver.integrate(system, t0, initial[i], t1, options);
+  });
+}
+
+}  // namespace jr_numeric::ode
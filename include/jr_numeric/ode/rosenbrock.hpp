@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+
+#include "jr_numeric/algebra/lu.hpp"
+#include "jr_numeric/algebra/matrix.hpp"
+#include "jr_numeric/ode/utils.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::ode {
+
+/**
+ * @brief Linearly implicit Rosenbrock method of order 2 with an order 3 error estimate, for stiff systems.
+ *
+ * The method of Shampine and Reichelt (ode23s), L-stable. The Jacobian and df/dt are approximated by forward
+ * differences at the start of every step, then the single matrix W = I - h d J is factorized and reused by all three
+ * stages. Jacobian, factorization and stages are members, so the stepping loop does not allocate.
+ */
+template <FloatingPoint T, std::size_t N>
+class Rosenbrock23 {
+  static constexpr T kD = 1 / (2 + std::numbers::sqrt2_v<T>);
+  static constexpr T kE32 = 6 + std::numbers::sqrt2_v<T>;
+
+  algebra::Matrix<N, N, T> jacobian_;
+  algebra::LuFactorization<N, T> w_;
+  State<T, N> dfdt_;
+  State<T, N> f0_;
+  State<T, N> f1_;
+  State<T, N> f2_;
+  State<T, N> k1_;
+  State<T, N> k2_;
+  State<T, N> k3_;
+  State<T, N> tmp_;
+  State<T, N> y1_;
+  State<T, N> error_;
+
+  template <typename Function>
+  auto linearize(Function const& system, T t, State<T, N> const& y, Statistics& statistics) -> void {
+    const auto sqrt_epsilon = std::sqrt(std::numeric_limits<T>::epsilon());
+
+    tmp_ = y;
+    for (auto j = 0u; j < N; j++) {
+      const auto h = sqrt_epsilon * std::max(T{1}, std::abs(y[j]));
+      tmp_[j] = y[j] + h;
+      const auto shifted = system(t, tmp_);
+      const auto step = tmp_[j] - y[j];
+      for (auto i = 0u; i < N; i++) jacobian_[i][j] = (shifted[i] - f0_[i]) / step;
+      tmp_[j] = y[j];
+    }
+
+    const auto h_t = sqrt_epsilon * std::max(T{1}, std::abs(t));
+    const auto shifted = system(t + h_t, y);
+    for (auto i = 0u; i < N; i++) dfdt_[i] = (shifted[i] - f0_[i]) / h_t;
+
+    statistics.evaluations_ += N + 1;
+  }
+
+  auto factorize(T h) -> void {
+    auto w = jacobian_ * (-h * kD);
+    for (auto i = 0u; i < N; i++) w[i][i] += 1;
+    w_ = algebra::luFactorize(w);
+  }
+
+  template <typename Function>
+  auto attempt(Function const& system, T t, State<T, N> const& y, T h) -> void {
+    for (auto i = 0u; i < N; i++) tmp_[i] = f0_[i] + h * kD * dfdt_[i];
+    k1_ = algebra::luSolve(w_, tmp_);
+
+    for (auto i = 0u; i < N; i++) tmp_[i] = y[i] + h / 2 * k1_[i];
+    f1_ = system(t + h / 2, tmp_);
+
+    for (auto i = 0u; i < N; i++) tmp_[i] = f1_[i] - k1_[i];
+    k2_ = algebra::luSolve(w_, tmp_);
+    for (auto i = 0u; i < N; i++) k2_[i] += k1_[i];
+
+    for (auto i = 0u; i < N; i++) y1_[i] = y[i] + h * k2_[i];
+    f2_ = system(t + h, y1_);
+
+    for (auto i = 0u; i < N; i++) {
+      tmp_[i] = f2_[i] - kE32 * (k2_[i] - f1_[i]) - 2 * (k1_[i] - f0_[i]) + h * kD * dfdt_[i];
+    }
+    k3_ = algebra::luSolve(w_, tmp_);
+
+    for (auto i = 0u; i < N; i++) error_[i] = h / 6 * (k1_[i] - 2 * k2_[i] + k3_[i]);
+  }
+
+ public:
+  static constexpr std::size_t kOrder = 2;
+
+  template <OdeSystem<T, N> Function, typename Observer = NoObserver>
+  auto integrate(
+      Function const& system,
+      T t0,
+      State<T, N> y,
+      T t1,
+      Options<T> const& options = {},
+      Observer const& observer = {}) -> Solution<T, N> {
+    auto statistics = Statistics{};
+    const auto direction = t1 >= t0 ? T{1} : T{-1};
+
+    f0_ = system(t0, y);
+    statistics.evaluations_++;
+
+    auto h = implementation::initialStep(system, t0, direction, y, f0_, kOrder, options, statistics);
+    auto t = t0;
+    auto linearized = false;
+
+    while (direction * (t1 - t) > 0) {
+      if (statistics.steps_ + statistics.rejected_ >= options.max_steps_) {
+        return Solution<T, N>{t, y, statistics};
+      }
+
+      h = std::min({h, options.max_step_, direction * (t1 - t)});
+      const auto last = h >= direction * (t1 - t);
+
+      // rejected steps keep the jacobian of the step start
+      if (!linearized) {
+        linearize(system, t, y, statistics);
+        linearized = true;
+      }
+      factorize(direction * h);
+      attempt(system, t, y, direction * h);
+      statistics.evaluations_ += 2;
+
+      const auto error = implementation::errorNorm(error_, y, y1_, options);
+      const auto factor = error == 0 ? T{5}
+                        : std::isnan(error) ? T{0.2}
+                                            : std::clamp(T{0.8} * std::pow(error, T{-1} / 3), T{0.2}, T{5});
+
+      // NaN errors are rejected too
+      if (!(error <= 1) || w_.singular_) {
+        statistics.rejected_++;
+        h *= std::min(factor, T{0.5});
+        // a step this small no longer moves t, the error estimate is unusable
+        if (t + direction * h == t) return Solution<T, N>{t, y, statistics};
+        continue;
+      }
+
+      t = last ? t1 : t + direction * h;
+      y = y1_;
+      f0_ = f2_;
+      linearized = false;
+      statistics.steps_++;
+
+      observer(t, y);
+
+      h *= factor;
+    }
+
+    statistics.success_ = true;
+    return Solution<T, N>{t, y, statistics};
+  }
+};
+
+}  // namespace jr_numeric::ode
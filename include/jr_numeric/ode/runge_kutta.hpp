@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+#include "jr_numeric/ode/utils.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::ode {
+
+/**
+ * @brief Classic fixed step Runge-Kutta method of order 4.
+ *
+ * The stages are kept as members, so after construction stepping does not touch the heap.
+ */
+template <FloatingPoint T, std::size_t N>
+class Rk4 {
+  State<T, N> k1_;
+  State<T, N> k2_;
+  State<T, N> k3_;
+  State<T, N> k4_;
+  State<T, N> tmp_;
+
+ public:
+  template <OdeSystem<T, N> Function>
+  auto step(Function const& system, T t, State<T, N>& y, T h) -> void {
+    k1_ = system(t, y);
+    for (auto i = 0u; i < N; i++) tmp_[i] = y[i] + h / 2 * k1_[i];
+    k2_ = system(t + h / 2, tmp_);
+    for (auto i = 0u; i < N; i++) tmp_[i] = y[i] + h / 2 * k2_[i];
+    k3_ = system(t + h / 2, tmp_);
+    for (auto i = 0u; i < N; i++) tmp_[i] = y[i] + h * k3_[i];
+    k4_ = system(t + h, tmp_);
+
+    for (auto i = 0u; i < N; i++) y[i] += h / 6 * (k1_[i] + 2 * k2_[i] + 2 * k3_[i] + k4_[i]);
+  }
+
+  /**
+   * @brief integrates from t0 to t1 in steps equal steps, observer(t, y) is called after every step
+   */
+  template <OdeSystem<T, N> Function, typename Observer = NoObserver>
+  auto integrate(
+      Function const& system, T t0, State<T, N> y0, T t1, std::size_t steps, Observer const& observer = {})
+      -> Solution<T, N> {
+    assert(steps > 0);
+    const auto h = (t1 - t0) / static_cast<T>(steps);
+
+    for (auto i = 0u; i < steps; i++) {
+      // not accumulated, so that t does not drift
+      const auto t = t0 + static_cast<T>(i) * h;
+      step(system, t, y0, h);
+      observer(t + h, y0);
+    }
+
+    return Solution<T, N>{t1, y0, Statistics{steps, 0, 4 * steps, true}};
+  }
+};
+
+/**
+ * @brief Adaptive Dormand-Prince 5(4) method with dense output of order 4.
+ *
+ * All stages and the dense output coefficients of the last accepted step are members of the solver, so one solver
+ * instance is a preallocated workspace and can be reused for any number of integrations.
+ */
+template <FloatingPoint T, std::size_t N>
+class DormandPrince {
+  static constexpr T kC2 = T{1} / 5, kC3 = T{3} / 10, kC4 = T{4} / 5, kC5 = T{8} / 9;
+
+  static constexpr T kA21 = T{1} / 5;
+  static constexpr T kA31 = T{3} / 40, kA32 = T{9} / 40;
+  static constexpr T kA41 = T{44} / 45, kA42 = T{-56} / 15, kA43 = T{32} / 9;
+  static constexpr T kA51 = T{19372} / 6561, kA52 = T{-25360} / 2187, kA53 = T{64448} / 6561, kA54 = T{-212} / 729;
+  static constexpr T kA61 = T{9017} / 3168, kA62 = T{-355} / 33, kA63 = T{46732} / 5247, kA64 = T{49} / 176,
+                     kA65 = T{-5103} / 18656;
+  static constexpr T kA71 = T{35} / 384, kA73 = T{500} / 1113, kA74 = T{125} / 192, kA75 = T{-2187} / 6784,
+                     kA76 = T{11} / 84;
+
+  static constexpr T kE1 = T{71} / 57600, kE3 = T{-71} / 16695, kE4 = T{71} / 1920, kE5 = T{-17253} / 339200,
+                     kE6 = T{22} / 525, kE7 = T{-1} / 40;
+
+  static constexpr T kD1 = T{-12715105075} / 11282082432, kD3 = T{87487479700} / 32700410799,
+                     kD4 = T{-10690763975} / 1880347072, kD5 = T{701980252875} / 199316789632,
+                     kD6 = T{-1453857185} / 822651844, kD7 = T{69997945} / 29380423;
+
+  std::array<State<T, N>, 7> k_;
+  State<T, N> tmp_;
+  State<T, N> y1_;
+  State<T, N> error_;
+  std::array<State<T, N>, 5> dense_;
+  T t_previous_{};
+  T h_previous_{};
+
+  // stage k_[0] has to hold f(t, y), on return y1_ holds the 5th order solution and k_[6] = f(t + h, y1_)
+  template <typename Function>
+  auto attempt(Function const& system, T t, State<T, N> const& y, T h) -> void {
+    auto& [k1, k2, k3, k4, k5, k6, k7] = k_;
+
+    for (auto i = 0u; i < N; i++) tmp_[i] = y[i] + h * kA21 * k1[i];
+    k2 = system(t + kC2 * h, tmp_);
+    for (auto i = 0u; i < N; i++) tmp_[i] = y[i] + h * (kA31 * k1[i] + kA32 * k2[i]);
+    k3 = system(t + kC3 * h, tmp_);
+    for (auto i = 0u; i < N; i++) tmp_[i] = y[i] + h * (kA41 * k1[i] + kA42 * k2[i] + kA43 * k3[i]);
+    k4 = system(t + kC4 * h, tmp_);
+    for (auto i = 0u; i < N; i++) {
+      tmp_[i] = y[i] + h * (kA51 * k1[i] + kA52 * k2[i] + kA53 * k3[i] + kA54 * k4[i]);
+    }
+    k5 = system(t + kC5 * h, tmp_);
+    for (auto i = 0u; i < N; i++) {
+      tmp_[i] = y[i] + h * (kA61 * k1[i] + kA62 * k2[i] + kA63 * k3[i] + kA64 * k4[i] + kA65 * k5[i]);
+    }
+    k6 = system(t + h, tmp_);
+    for (auto i = 0u; i < N; i++) {
+      y1_[i] = y[i] + h * (kA71 * k1[i] + kA73 * k3[i] + kA74 * k4[i] + kA75 * k5[i] + kA76 * k6[i]);
+    }
+    k7 = system(t + h, y1_);
+
+    for (auto i = 0u; i < N; i++) {
+      error_[i] = h * (kE1 * k1[i] + kE3 * k3[i] + kE4 * k4[i] + kE5 * k5[i] + kE6 * k6[i] + kE7 * k7[i]);
+    }
+  }
+
+  auto prepareDense(State<T, N> const& y, T t, T h) -> void {
+    auto const& [k1, k2, k3, k4, k5, k6, k7] = k_;
+    for (auto i = 0u; i < N; i++) {
+      const auto diff = y1_[i] - y[i];
+      const auto bspl = h * k1[i] - diff;
+      dense_[0][i] = y[i];
+      dense_[1][i] = diff;
+      dense_[2][i] = bspl;
+      dense_[3][i] = diff - h * k7[i] - bspl;
+      dense_[4][i] = h * (kD1 * k1[i] + kD3 * k3[i] + kD4 * k4[i] + kD5 * k5[i] + kD6 * k6[i] + kD7 * k7[i]);
+    }
+    t_previous_ = t;
+    h_previous_ = h;
+  }
+
+ public:
+  static constexpr std::size_t kOrder = 5;
+
+  /**
+   * @brief Integrates from t0 to t1 (t1 < t0 is fine), observer(t, y) is called after every accepted step.
+   *
+   * Inside the observer denseOutput can be used for any time between previousTime() and t.
+   */
+  template <OdeSystem<T, N> Function, typename Observer = NoObserver>
+  auto integrate(
+      Function const& system,
+      T t0,
+      State<T, N> y,
+      T t1,
+      Options<T> const& options = {},
+      Observer const& observer = {}) -> Solution<T, N> {
+    auto statistics = Statistics{};
+    const auto direction = t1 >= t0 ? T{1} : T{-1};
+
+    k_[0] = system(t0, y);
+    statistics.evaluations_++;
+
+    auto h = implementation::initialStep(system, t0, direction, y, k_[0], kOrder, options, statistics);
+    auto t = t0;
+
+    while (direction * (t1 - t) > 0) {
+      if (statistics.steps_ + statistics.rejected_ >= options.max_steps_) {
+        return Solution<T, N>{t, y, statistics};
+      }
+
+      h = std::min({h, options.max_step_, direction * (t1 - t)});
+      const auto last = h >= direction * (t1 - t);
+
+      attempt(system, t, y, direction * h);
+      statistics.evaluations_ += 6;
+
+      const auto error = implementation::errorNorm(error_, y, y1_, options);
+      const auto factor = error == 0 ? T{5}
+                        : std::isnan(error) ? T{0.2}
+                                            : std::clamp(T{0.9} * std::pow(error, T{-1} / kOrder), T{0.2}, T{5});
+
+      // NaN errors are rejected too
+      if (!(error <= 1)) {
+        statistics.rejected_++;
+        h *= std::min(factor, T{1});
+        // a step this small no longer moves t, the error estimate is unusable
+        if (t + direction * h == t) return Solution<T, N>{t, y, statistics};
+        continue;
+      }
+
+      prepareDense(y, t, direction * h);
+      t = last ? t1 : t + direction * h;
+      y = y1_;
+      k_[0] = k_[6];  // first same as last
+      statistics.steps_++;
+
+      observer(t, y);
+
+      h *= factor;
+    }
+
+    statistics.success_ = true;
+    return Solution<T, N>{t, y, statistics};
+  }
+
+  [[nodiscard]] auto previousTime() const noexcept -> T { return t_previous_; }
+
+  /**
+   * @brief state at time t within the last accepted step
+   */
+  [[nodiscard]] auto denseOutput(T t) const noexcept -> State<T, N> {
+    const auto theta = (t - t_previous_) / h_previous_;
+    const auto theta1 = 1 - theta;
+    State<T, N> res;
+    for (auto i = 0u; i < N; i++) {
+      res[i] = dense_[0][i] +
+               theta * (dense_[1][i] + theta1 * (dense_[2][i] + theta * (dense_[3][i] + theta1 * dense_[4][i])));
+    }
+    return res;
+  }
+};
+
+}  // namespace jr_numeric::ode
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::ode {
+
+using concepts::FloatingPoint;
+
+template <FloatingPoint T, std::size_t N>
+using State = std::array<T, N>;
+
+/**
+ * @brief right hand side of dy/dt = f(t, y), returns dy/dt by value so that no heap memory is involved
+ */
+template <typename Function, typename T, std::size_t N>
+concept OdeSystem = std::is_invocable_r_v<State<T, N>, Function const&, T, State<T, N> const&>;
+
+template <FloatingPoint T>
+struct Options {
+  T relative_tolerance_ = 1e-6;
+  T absolute_tolerance_ = 1e-9;
+  T initial_step_ = 0;  // 0 - picked from the derivative at t0
+  T max_step_ = std::numeric_limits<T>::infinity();
+  std::size_t max_steps_ = 100000;
+};
+
+struct Statistics {
+  std::size_t steps_{};
+  std::size_t rejected_{};
+  std::size_t evaluations_{};
+  bool success_{};
+};
+
+template <FloatingPoint T, std::size_t N>
+struct Solution {
+  T t_{};
+  State<T, N> y_{};
+  Statistics statistics_{};
+};
+
+// does nothing with the accepted steps
+struct NoObserver {
+  template <typename... Args>
+  constexpr auto operator()(Args const&...) const noexcept -> void {}
+};
+
+namespace implementation {
+
+// root mean square of the error scaled by the tolerances, <= 1 means the step is accepted
+template <FloatingPoint T, std::size_t N>
+auto errorNorm(State<T, N> const& error, State<T, N> const& y0, State<T, N> const& y1, Options<T> const& options)
+    -> T {
+  auto sum = T{};
+  for (auto i = 0u; i < N; i++) {
+    const auto scale =
+        options.absolute_tolerance_ + options.relative_tolerance_ * std::max(std::abs(y0[i]), std::abs(y1[i]));
+    const auto scaled = error[i] / scale;
+    sum += scaled * scaled;
+  }
+  return std::sqrt(sum / N);
+}
+
+// Hairer, Norsett, Wanner - Solving ODEs I, II.4, the magnitude of the step, direction is +1 or -1
+template <FloatingPoint T, std::size_t N, typename Function>
+auto initialStep(
+    Function const& system,
+    T t0,
+    T direction,
+    State<T, N> const& y0,
+    State<T, N> const& f0,
+    std::size_t order,
+    Options<T> const& options,
+    Statistics& statistics) -> T {
+  if (options.initial_step_ > 0) return options.initial_step_;
+
+  auto scale = [&options](T y) { return options.absolute_tolerance_ + options.relative_tolerance_ * std::abs(y); };
+
+  auto d0 = T{};
+  auto d1 = T{};
+  for (auto i = 0u; i < N; i++) {
+    d0 += (y0[i] / scale(y0[i])) * (y0[i] / scale(y0[i]));
+    d1 += (f0[i] / scale(y0[i])) * (f0[i] / scale(y0[i]));
+  }
+  d0 = std::sqrt(d0 / N);
+  d1 = std::sqrt(d1 / N);
+
+  auto h0 = (d0 < T{1e-5} || d1 < T{1e-5}) ? T{1e-6} : T{0.01} * d0 / d1;
+  h0 = std::min(h0, options.max_step_);
+
+  State<T, N> y1;
+  for (auto i = 0u; i < N; i++) y1[i] = y0[i] + direction * h0 * f0[i];
+  const auto f1 = system(t0 + direction * h0, y1);
+  statistics.evaluations_++;
+
+  auto d2 = T{};
+  for (auto i = 0u; i < N; i++) {
+    const auto diff = (f1[i] - f0[i]) / scale(y0[i]);
+    d2 += diff * diff;
+  }
+  d2 = std::sqrt(d2 / N) / h0;
+
+  const auto max_d = std::max(d1, d2);
+  const auto h1 = max_d <= T{1e-15} ? std::max(T{1e-6}, h0 * T{1e-3})
+                                    : std::pow(T{0.01} / max_d, T{1} / static_cast<T>(order + 1));
+
+  return std::min({100 * h0, h1, options.max_step_});
+}
+
+}  // namespace implementation
+
+}  // namespace jr_numeric::ode
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "jr_numeric/optimization/utils.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::optimization {
+
+/**
+ * @brief Limited memory BFGS for smooth objectives, keeps the last M curvature pairs.
+ *
+ * Steps satisfy the strong Wolfe conditions. The gradient comes from one evaluation on dual numbers when the objective
+ * accepts them, otherwise from central differences (2N extra evaluations). The history, directions and trial points
+ * are members, so one instance is a preallocated workspace for any number of minimizations.
+ */
+template <FloatingPoint T, std::size_t N, std::size_t M = 8>
+class Lbfgs {
+  static constexpr T kArmijo = T{1e-4};
+  static constexpr T kCurvature = T{0.9};
+  static constexpr std::size_t kLineSearchIterations = 20;
+
+  using Point = std::array<T, N>;
+
+  std::array<Point, M> s_;
+  std::array<Point, M> y_;
+  std::array<T, M> rho_;
+  std::array<T, M> alpha_;
+  std::size_t history_{};  // number of stored pairs
+  std::size_t newest_{};
+
+  Point x_;
+  Point gradient_;
+  Point direction_;
+  Point x_trial_;
+  Point gradient_trial_;
+  T value_trial_{};
+
+  static auto dot(Point const& a, Point const& b) noexcept -> T {
+    auto res = T{};
+    for (auto i = 0u; i < N; i++) res += a[i] * b[i];
+    return res;
+  }
+
+  // direction_ = -H gradient_ by the two loop recursion
+  auto computeDirection() noexcept -> void {
+    for (auto i = 0u; i < N; i++) direction_[i] = -gradient_[i];
+
+    for (auto k = 0u; k < history_; k++) {
+      const auto j = (newest_ + M - k) % M;
+      alpha_[j] = rho_[j] * dot(s_[j], direction_);
+      for (auto i = 0u; i < N; i++) direction_[i] -= alpha_[j] * y_[j][i];
+    }
+
+    if (history_ > 0) {
+      const auto gamma = dot(s_[newest_], y_[newest_]) / dot(y_[newest_], y_[newest_]);
+      for (auto& d : direction_) d *= gamma;
+    }
+
+    for (auto k = history_; k-- > 0;) {
+      const auto j = (newest_ + M - k) % M;
+      const auto beta = rho_[j] * dot(y_[j], direction_);
+      for (auto i = 0u; i < N; i++) direction_[i] += (alpha_[j] - beta) * s_[j][i];
+    }
+  }
+
+  // minimizer of the cubic through (a, fa, da) and (b, fb, db), bisection when it falls outside the safe region
+  static auto interpolate(T a, T fa, T da, T b, T fb, T db) noexcept -> T {
+    const auto d1 = da + db - 3 * (fa - fb) / (a - b);
+    const auto discriminant = d1 * d1 - da * db;
+    const auto low = std::min(a, b), high = std::max(a, b);
+    const auto margin = (high - low) / 10;
+    if (discriminant >= 0) {
+      const auto d2 = std::copysign(std::sqrt(discriminant), b - a);
+      const auto x = b - (b - a) * (db + d2 - d1) / (db - da + 2 * d2);
+      if (x > low + margin && x < high - margin) return x;
+    }
+    return (a + b) / 2;
+  }
+
+  /**
+   * @brief strong Wolfe line search along direction_ from x_, on success the accepted point is in the trial members
+   */
+  template <typename Function>
+  auto lineSearch(Function const& function, T value, T initial_step, std::size_t budget, std::size_t& evaluations)
+      -> bool {
+    const auto slope0 = dot(gradient_, direction_);
+
+    auto probe = [&](T step) {
+      for (auto i = 0u; i < N; i++) x_trial_[i] = x_[i] + step * direction_[i];
+      evaluations += implementation::valueAndGradient(function, x_trial_, value_trial_, gradient_trial_);
+      return std::pair{value_trial_, dot(gradient_trial_, direction_)};
+    };
+    auto sufficient = [&](T step, T phi) { return phi <= value + kArmijo * step * slope0; };
+    auto curvature = [&](T slope) { return std::abs(slope) <= -kCurvature * slope0; };
+
+    auto zoom = [&](T low, T phi_low, T slope_low, T high, T phi_high, T slope_high) {
+      for (auto i = 0u; i < kLineSearchIterations && evaluations < budget; i++) {
+        const auto step = interpolate(low, phi_low, slope_low, high, phi_high, slope_high);
+        const auto [phi, slope] = probe(step);
+        if (!sufficient(step, phi) || phi >= phi_low) {
+          high = step, phi_high = phi, slope_high = slope;
+        } else {
+          if (curvature(slope)) return true;
+          if (slope * (high - low) >= 0) high = low, phi_high = phi_low, slope_high = slope_low;
+          low = step, phi_low = phi, slope_low = slope;
+        }
+      }
+      return false;
+    };
+
+    auto previous = T{}, phi_previous = value, slope_previous = slope0;
+    auto step = initial_step;
+    for (auto i = 0u; i < kLineSearchIterations && evaluations < budget; i++) {
+      const auto [phi, slope] = probe(step);
+      if (!sufficient(step, phi) || (i > 0 && phi >= phi_previous)) {
+        return zoom(previous, phi_previous, slope_previous, step, phi, slope);
+      }
+      if (curvature(slope)) return true;
+      if (slope >= 0) return zoom(step, phi, slope, previous, phi_previous, slope_previous);
+
+      previous = step, phi_previous = phi, slope_previous = slope;
+      step *= 2;
+    }
+    return false;
+  }
+
+ public:
+  template <Objective<T, N> Function>
+  auto minimize(Function const& function, Point const& x0, Options<T> const& options = {}) -> Minimum<T, N> {
+    auto res = Minimum<T, N>{};
+    history_ = newest_ = 0;
+    x_ = x0;
+
+    auto value = T{};
+    res.evaluations_ = implementation::valueAndGradient(function, x_, value, gradient_);
+
+    for (;; res.iterations_++) {
+      auto gradient_norm = T{};
+      for (const auto g : gradient_) gradient_norm = std::max(gradient_norm, std::abs(g));
+      if (gradient_norm <= options.gradient_tolerance_) {
+        res.converged_ = true;
+        break;
+      }
+      if (res.evaluations_ >= options.max_evaluations_) break;
+
+      computeDirection();
+      if (dot(direction_, gradient_) >= 0) {
+        // the history lost positive definiteness, start over with steepest descent
+        history_ = 0;
+        computeDirection();
+      }
+
+      // the first step is scaled so that it does not move x by more than 1
+      const auto initial_step = history_ == 0 ? std::min(T{1}, T{1} / gradient_norm) : T{1};
+      if (!lineSearch(function, value, initial_step, options.max_evaluations_, res.evaluations_)) {
+        if (history_ == 0) break;
+        history_ = 0;
+        continue;
+      }
+
+      const auto next = history_ == 0 ? newest_ : (newest_ + 1) % M;
+      for (auto i = 0u; i < N; i++) {
+        s_[next][i] = x_trial_[i] - x_[i];
+        y_[next][i] = gradient_trial_[i] - gradient_[i];
+      }
+      const auto sy = dot(s_[next], y_[next]);
+      if (sy > std::numeric_limits<T>::epsilon() * dot(y_[next], y_[next])) {
+        rho_[next] = 1 / sy;
+        newest_ = next;
+        history_ = std::min(history_ + 1, M);
+      }
+
+      const auto decrease = value - value_trial_;
+      x_ = x_trial_;
+      gradient_ = gradient_trial_;
+      value = value_trial_;
+
+      if (decrease <= options.f_tolerance_ * std::max({T{1}, std::abs(value), std::abs(value + decrease)})) {
+        res.iterations_++;
+        res.converged_ = true;
+        break;
+      }
+    }
+
+    res.x_ = x_;
+    res.value_ = value;
+    return res;
+  }
+};
+
+}  // namespace jr_numeric::optimization
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "jr_numeric/optimization/utils.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::optimization {
+
+namespace implementation {
+
+template <FloatingPoint T>
+constexpr auto kGolden = T{0.381966011250105151795413165634361882};  // (3 - sqrt(5)) / 2
+
+template <FloatingPoint T>
+auto tolerance(Options<T> const& options, T x) noexcept -> T {
+  return options.x_tolerance_ * std::max(T{1}, std::abs(x));
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Minimum of a unimodal function on [low, high], the bracket shrinks by the golden ratio per evaluation.
+ */
+template <FloatingPoint T>
+auto goldenSection(concepts::R1RealFunction auto const& function, T low, T high, Options<T> const& options = {})
+    -> ScalarMinimum<T> {
+  assert(low < high);
+  constexpr auto kC = implementation::kGolden<T>;
+
+  auto x1 = low + kC * (high - low);
+  auto x2 = high - kC * (high - low);
+  T f1 = function(x1), f2 = function(x2);
+  auto res = ScalarMinimum<T>{};
+  res.evaluations_ = 2;
+
+  while (high - low > 2 * implementation::tolerance(options, (low + high) / 2)) {
+    if (res.evaluations_ >= options.max_evaluations_) break;
+
+    if (f1 < f2) {
+      high = x2;
+      x2 = x1, f2 = f1;
+      x1 = low + kC * (high - low);
+      f1 = function(x1);
+    } else {
+      low = x1;
+      x1 = x2, f1 = f2;
+      x2 = high - kC * (high - low);
+      f2 = function(x2);
+    }
+    res.evaluations_++;
+  }
+
+  res.converged_ = high - low <= 2 * implementation::tolerance(options, (low + high) / 2);
+  res.x_ = f1 < f2 ? x1 : x2;
+  res.value_ = f1 < f2 ? f1 : f2;
+  return res;
+}
+
+/**
+ * @brief Brent's minimization on [low, high], parabolic interpolation safeguarded by golden section steps.
+ *
+ * Converges superlinearly for smooth functions and never much slower than golden section.
+ */
+template <FloatingPoint T>
+auto brent(concepts::R1RealFunction auto const& function, T low, T high, Options<T> const& options = {})
+    -> ScalarMinimum<T> {
+  assert(low < high);
+  constexpr auto kC = implementation::kGolden<T>;
+
+  auto a = low, b = high;
+  auto x = a + kC * (b - a);
+  auto w = x, v = x;
+  T fx = function(x);
+  auto fw = fx, fv = fx;
+  auto d = T{}, e = T{};
+
+  auto res = ScalarMinimum<T>{};
+  res.evaluations_ = 1;
+
+  for (;;) {
+    const auto m = (a + b) / 2;
+    const auto tol = implementation::tolerance(options, x) / 2;
+    const auto tol2 = 2 * tol;
+
+    if (std::abs(x - m) <= tol2 - (b - a) / 2) {
+      res.converged_ = true;
+      break;
+    }
+    if (res.evaluations_ >= options.max_evaluations_) break;
+
+    auto golden = true;
+    if (std::abs(e) > tol) {
+      // parabola through x, w, v
+      auto r = (x - w) * (fx - fv);
+      auto q = (x - v) * (fx - fw);
+      auto p = (x - v) * q - (x - w) * r;
+      q = 2 * (q - r);
+      if (q > 0)
+        p = -p;
+      else
+        q = -q;
+      r = e;
+      e = d;
+
+      if (std::abs(p) < std::abs(q * r / 2) && p > q * (a - x) && p < q * (b - x)) {
+        d = p / q;
+        const auto u = x + d;
+        // not too close to the ends of the bracket
+        if (u - a < tol2 || b - u < tol2) d = x < m ? tol : -tol;
+        golden = false;
+      }
+    }
+    if (golden) {
+      e = (x < m ? b : a) - x;
+      d = kC * e;
+    }
+
+    const auto u = x + (std::abs(d) >= tol ? d : std::copysign(tol, d));
+    const T fu = function(u);
+    res.evaluations_++;
+
+    if (fu <= fx) {
+      (u < x ? b : a) = x;
+      v = w, fv = fw;
+      w = x, fw = fx;
+      x = u, fx = fu;
+    } else {
+      (u < x ? a : b) = u;
+      if (fu <= fw || w == x) {
+        v = w, fv = fw;
+        w = u, fw = fu;
+      } else if (fu <= fv || v == x || v == w) {
+        v = u, fv = fu;
+      }
+    }
+  }
+
+  res.x_ = x;
+  res.value_ = fx;
+  return res;
+}
+
+}  // namespace jr_numeric::optimization
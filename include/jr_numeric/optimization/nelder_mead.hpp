@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include "jr_numeric/optimization/utils.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::optimization {
+
+/**
+ * @brief Derivative free simplex search, for noisy or non smooth objectives.
+ *
+ * Uses the dimension dependent coefficients of Gao and Han, which keep the simplex from degenerating for larger N,
+ * and the standard ones for N = 1. Stops when both the spread of the values and the size of the simplex fall below
+ * the tolerances. The simplex is a member, so an instance is reusable without allocations.
+ */
+template <FloatingPoint T, std::size_t N>
+class NelderMead {
+  static_assert(N >= 1);
+
+  // the coefficients of Gao and Han are meant for N >= 2, at N = 2 they are the standard 2, 0.5 and 0.5, which also
+  // serve N = 1, where their shrink would be 0 and collapse the simplex onto the best vertex
+  static constexpr std::size_t kDimension = std::max<std::size_t>(N, 2);
+  static constexpr T kReflection = 1;
+  static constexpr T kExpansion = 1 + T{2} / kDimension;
+  static constexpr T kContraction = T{0.75} - T{1} / (2 * kDimension);
+  static constexpr T kShrink = 1 - T{1} / kDimension;
+
+  using Point = std::array<T, N>;
+
+  std::array<Point, N + 1> simplex_;
+  std::array<T, N + 1> values_;
+  std::array<std::size_t, N + 1> order_;  // simplex_[order_[0]] is the best vertex
+  Point centroid_;
+  Point trial_;
+
+  // centroid + coefficient * (centroid - worst)
+  auto along(T coefficient, Point& out) const noexcept -> void {
+    const auto& worst = simplex_[order_[N]];
+    for (auto i = 0u; i < N; i++) out[i] = centroid_[i] + coefficient * (centroid_[i] - worst[i]);
+  }
+
+ public:
+  /**
+   * @param step initial size of the simplex along every axis, relative to max(1, |x0_i|) when not given
+   */
+  template <Objective<T, N> Function>
+  auto minimize(Function const& function, Point const& x0, Options<T> const& options = {}, T step = 0)
+      -> Minimum<T, N> {
+    auto res = Minimum<T, N>{};
+
+    auto evaluate = [&](Point const& x) {
+      res.evaluations_++;
+      return static_cast<T>(implementation::evaluate(function, x));
+    };
+
+    simplex_.fill(x0);
+    for (auto i = 0u; i < N; i++) {
+      const auto h = step != 0 ? step : T{0.05} * std::max(T{1}, std::abs(x0[i]));
+      simplex_[i + 1][i] += h;
+    }
+    for (auto k = 0u; k <= N; k++) {
+      values_[k] = evaluate(simplex_[k]);
+      order_[k] = k;
+    }
+
+    for (;; res.iterations_++) {
+      std::ranges::sort(order_, [&](std::size_t a, std::size_t b) { return values_[a] < values_[b]; });
+      const auto best = order_[0], worst = order_[N], second = order_[N - 1];
+
+      auto size = T{};
+      for (auto k = 1u; k <= N; k++) {
+        for (auto i = 0u; i < N; i++) {
+          const auto distance = std::abs(simplex_[order_[k]][i] - simplex_[best][i]);
+          size = std::max(size, distance / std::max(T{1}, std::abs(simplex_[best][i])));
+        }
+      }
+      const auto spread = values_[worst] - values_[best];
+      if (size <= options.x_tolerance_ && spread <= options.f_tolerance_ * std::max(T{1}, std::abs(values_[best]))) {
+        res.converged_ = true;
+        break;
+      }
+      if (res.evaluations_ >= options.max_evaluations_) break;
+
+      centroid_.fill(T{});
+      for (auto k = 0u; k < N; k++) {
+        for (auto i = 0u; i < N; i++) centroid_[i] += simplex_[order_[k]][i];
+      }
+      for (auto& c : centroid_) c /= N;
+
+      along(kReflection, trial_);
+      const auto reflected = evaluate(trial_);
+
+      if (reflected < values_[best]) {
+        const auto reflection = trial_;
+        along(kExpansion, trial_);
+        const auto expanded = evaluate(trial_);
+        if (expanded < reflected) {
+          simplex_[worst] = trial_, values_[worst] = expanded;
+        } else {
+          simplex_[worst] = reflection, values_[worst] = reflected;
+        }
+        continue;
+      }
+      if (reflected < values_[second]) {
+        simplex_[worst] = trial_, values_[worst] = reflected;
+        continue;
+      }
+
+      // outside contraction when the reflection improved on the worst vertex, inside otherwise
+      const auto outside = reflected < values_[worst];
+      along(outside ? kContraction : -kContraction, trial_);
+      const auto contracted = evaluate(trial_);
+      if (contracted < (outside ? reflected : values_[worst])) {
+        simplex_[worst] = trial_, values_[worst] = contracted;
+        continue;
+      }
+
+      for (auto k = 1u; k <= N; k++) {
+        auto& vertex = simplex_[order_[k]];
+        for (auto i = 0u; i < N; i++) vertex[i] = simplex_[best][i] + kShrink * (vertex[i] - simplex_[best][i]);
+        values_[order_[k]] = evaluate(vertex);
+      }
+    }
+
+    res.x_ = simplex_[order_[0]];
+    res.value_ = values_[order_[0]];
+    return res;
+  }
+};
+
+}  // namespace jr_numeric::optimization
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "jr_numeric/differential/dual.hpp"
+#include "jr_numeric/differential/gradient.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::optimization {
+
+using concepts::FloatingPoint;
+
+/**
+ * @brief f: R^N -> R taking either N arguments of type T (as ScalarField) or a single std::array<T, N>
+ */
+template <typename Function, typename T, std::size_t N>
+concept Objective = std::is_invocable_r_v<T, Function const&, std::array<T, N> const&> ||
+                    differential::InvocableWith<Function, T, N>;
+
+/**
+ * @brief objective that can also be evaluated on Dual<T, N>, which gives the gradient from a single evaluation
+ */
+template <typename Function, typename T, std::size_t N>
+concept DualObjective =
+    std::is_invocable_r_v<differential::Dual<T, N>, Function const&, std::array<differential::Dual<T, N>, N> const&> ||
+    differential::DualScalarField<Function, T, N>;
+
+template <FloatingPoint T>
+struct Options {
+  T x_tolerance_ = std::sqrt(std::numeric_limits<T>::epsilon());  // on the change of x, relative to max(1, |x|)
+  T f_tolerance_ = 4 * std::numeric_limits<T>::epsilon();         // on the change of f, relative to max(1, |f|)
+  T gradient_tolerance_ = T{1e-8};                                // on max |df/dx_i|, gradient based methods only
+  std::size_t max_evaluations_ = 10000;                           // budget of calls to the objective
+};
+
+template <FloatingPoint T>
+struct ScalarMinimum {
+  T x_{};
+  T value_{};
+  std::size_t evaluations_{};
+  bool converged_{};
+};
+
+template <FloatingPoint T, std::size_t N>
+struct Minimum {
+  std::array<T, N> x_{};
+  T value_{};
+  std::size_t iterations_{};
+  std::size_t evaluations_{};
+  bool converged_{};
+};
+
+namespace implementation {
+
+template <typename X, std::size_t N, typename Function>
+auto evaluate(Function const& function, std::array<X, N> const& x) {
+  if constexpr (std::is_invocable_v<Function const&, std::array<X, N> const&>)
+    return function(x);
+  else
+    return std::apply(function, x);
+}
+
+/**
+ * @brief f(x) and its gradient, from one evaluation on dual numbers when the objective allows it, otherwise from
+ * central differences
+ *
+ * @return number of evaluations spent
+ */
+template <FloatingPoint T, std::size_t N, typename Function>
+auto valueAndGradient(Function const& function, std::array<T, N> const& x, T& value, std::array<T, N>& gradient)
+    -> std::size_t {
+  if constexpr (DualObjective<Function, T, N>) {
+    std::array<differential::Dual<T, N>, N> dual;
+    for (auto i = 0u; i < N; i++) dual[i] = differential::Dual<T, N>::variable(x[i], i);
+    const auto res = evaluate(function, dual);
+    value = res.value_;
+    gradient = res.gradient_;
+    return 1;
+  } else {
+    value = static_cast<T>(evaluate(function, x));
+    auto spread = [&function](auto... args) { return evaluate(function, std::array<T, N>{args...}); };
+    gradient = differential::gradient(spread, x);
+    return 1 + 2 * N;
+  }
+}
+
+}  // namespace implementation
+
+}  // namespace jr_numeric::optimization
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "jr_numeric/root_finding/bracketing.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+namespace jr_numeric::roots {
+
+/**
+ * @brief f(x, parameter), one equation per parameter
+ */
+template <typename Function, typename T, typename Parameter>
+concept ParametrizedFunction = std::is_invocable_r_v<T, Function const&, T, Parameter const&>;
+
+namespace implementation {
+
+/**
+ * @brief Illinois iterations of Lanes equations at once, kept as structure of arrays.
+ *
+ * A sweep is three branch free loops over the lanes: secant points, evaluations and bracket updates by selects. The
+ * first and last vectorize, the evaluations do when the function inlines into vector code. Keeping them apart matters
+ * for a function that calls into a scalar library such as std::sin, which otherwise forces the vector state of the
+ * whole loop to be spilled around every call. Finished lanes keep their state and only their evaluation is wasted,
+ * retiring and refilling them is left to the caller between sweeps. Every array the sweep touches has elements of
+ * type T, so that the masks have the width of the data.
+ */
+template <std::size_t Lanes, FloatingPoint T, typename Parameter>
+struct IllinoisLanes {
+  std::array<T, Lanes> a_, b_, fa_, fb_, c_, fc_;
+  std::array<T, Lanes> trial_, f_trial_;  // secant points of the sweep and their values
+  std::array<T, Lanes> fa_scaled_, fb_scaled_;  // f(a) and f(b) times their Illinois factors
+  std::array<T, Lanes> scale_a_;                 // 0.5 when b was replaced last, the factor of f(a) if it is again
+  std::array<T, Lanes> scale_b_;                 // 0.5 when a was replaced last
+  std::array<T, Lanes> iterations_;  // a count, stored as T
+  std::array<T, Lanes> done_;        // 1 converged or out of iterations, 0 iterating
+  std::array<T, Lanes> converged_;
+  std::array<Parameter, Lanes> parameters_;  // copies, so that evaluating the lanes reads contiguous memory
+  std::array<std::size_t, Lanes> index_;     // equation of the lane, only read when it retires
+  std::array<bool, Lanes> active_;           // holds an equation whose result is not reported yet
+
+  // returns the number of finished lanes
+  template <typename Function>
+  auto sweep(Function const& function, RootOptions<T> const& options) noexcept -> std::size_t {
+    // locals, a read through options could alias the lanes and would be repeated in every lane
+    const auto max_iterations = static_cast<T>(std::max<std::size_t>(options.max_iterations_, 1));
+    const auto absolute = options.absolute_tolerance_;
+    const auto relative = options.relative_tolerance_;
+    const auto function_tolerance = options.function_tolerance_;
+
+    for (auto l = 0u; l < Lanes; l++) {
+      trial_[l] = (a_[l] * fb_[l] - b_[l] * fa_[l]) / (fb_[l] - fa_[l]);
+      fa_scaled_[l] = fa_[l] * scale_a_[l];
+      fb_scaled_[l] = fb_[l] * scale_b_[l];
+    }
+    for (auto l = 0u; l < Lanes; l++) f_trial_[l] = function(trial_[l], parameters_[l]);
+
+    // all arithmetic is unconditional and only its results are selected: floating point operations and ordered
+    // comparisons that execute conditionally may trap, and the compiler keeps them as branches
+    auto finished = T{};
+    for (auto l = 0u; l < Lanes; l++) {
+      const auto c = trial_[l];
+      const auto fc = f_trial_[l];
+
+      const auto same_as_b = (fc < 0) == (fb_[l] < 0);
+      const auto a = same_as_b ? a_[l] : c;
+      const auto fa = same_as_b ? fa_scaled_[l] : fc;
+      const auto b = same_as_b ? c : b_[l];
+      const auto fb = same_as_b ? fc : fb_scaled_[l];
+      const auto tolerance = absolute + relative * std::abs(c);
+      const auto converged = (std::abs(fc) <= function_tolerance) | (std::abs(b - a) <= 2 * tolerance) | (fc == 0);
+
+      // no short circuits, they would turn into branches
+      const auto iterating = done_[l] == 0;
+      const auto iterations = iterations_[l] + 1;
+      a_[l] = iterating ? a : a_[l];
+      fa_[l] = iterating ? fa : fa_[l];
+      b_[l] = iterating ? b : b_[l];
+      fb_[l] = iterating ? fb : fb_[l];
+      c_[l] = iterating ? c : c_[l];
+      fc_[l] = iterating ? fc : fc_[l];
+      scale_a_[l] = iterating ? (same_as_b ? T{0.5} : T{1}) : scale_a_[l];
+      scale_b_[l] = iterating ? (same_as_b ? T{1} : T{0.5}) : scale_b_[l];
+      iterations_[l] = iterating ? iterations : iterations_[l];
+      converged_[l] = iterating & converged ? T{1} : converged_[l];
+      done_[l] = iterating & !converged & (iterations != max_iterations) ? T{} : T{1};
+      finished += done_[l];
+    }
+    return static_cast<std::size_t>(finished);
+  }
+};
+
+}  // namespace implementation
+
+/**
+ * @brief Solves f(x, parameters[i]) = 0 on [low[i], high[i]] for every i with the Illinois method.
+ *
+ * Equations are processed Lanes at a time by branch free sweeps. Once a quarter of the lanes are done they are retired
+ * and refilled with the next equations, so a slow equation does not hold the others back and the refill pass is not
+ * paid after every sweep. Roots, iterations and evaluations are the same as those of illinois. Chunks of equations are
+ * spread over threads. Brackets without a sign change are reported as not converged instead of asserting.
+ *
+ * The lanes pay off with vectors of 256 bits or wider (x86-64-v3 or newer), with SSE2 alone they are about as fast
+ * as calling illinois in a loop.
+ *
+ * @param function f(x, parameter), should be cheap to inline for the lanes to vectorize
+ * @return number of equations that did not converge
+ */
+template <std::size_t Lanes = 32, FloatingPoint T, typename Parameter, ParametrizedFunction<T, Parameter> Function>
+auto solveBatch(
+    Function const& function,
+    std::span<const Parameter> parameters,
+    std::span<const T> low,
+    std::span<const T> high,
+    std::span<RootResult<T>> results,
+    RootOptions<T> const& options = {},
+    std::size_t threads = utils::hardwareThreads()) -> std::size_t {
+  const auto n = parameters.size();
+  assert(low.size() == n && high.size() == n && results.size() >= n);
+  std::vector<std::size_t> failures(std::max<std::size_t>(threads, 1), 0);
+
+  utils::parallelChunks(n, threads, [&](std::size_t id, std::size_t begin, std::size_t end) {
+    auto lanes = implementation::IllinoisLanes<Lanes, T, Parameter>{};
+    auto next = begin;
+    auto active = std::size_t{0};
+    constexpr auto kRefill = std::max<std::size_t>(Lanes / 4, 1);
+
+    auto finish = [&](std::size_t i, T root, T value, std::size_t iterations, bool converged) {
+      results[i] = RootResult<T>{root, value, iterations, iterations + 2, converged};
+      if (!converged) failures[id]++;
+    };
+
+    // takes the next equation with a proper bracket, equations solved by their end points retire immediately
+    auto load = [&](std::size_t l) {
+      while (next < end) {
+        const auto i = next++;
+        const T fa = function(low[i], parameters[i]);
+        const T fb = function(high[i], parameters[i]);
+
+        if (fa == 0 || fb == 0) {
+          finish(i, fa == 0 ? low[i] : high[i], fa == 0 ? fa : fb, 0, true);
+        } else if (!implementation::differentSigns(fa, fb)) {
+          finish(i, low[i], fa, 0, false);
+        } else {
+          lanes.a_[l] = low[i], lanes.b_[l] = high[i];
+          lanes.fa_[l] = fa, lanes.fb_[l] = fb;
+          lanes.scale_a_[l] = lanes.scale_b_[l] = T{1};
+          lanes.iterations_[l] = lanes.done_[l] = lanes.converged_[l] = T{};
+          lanes.parameters_[l] = parameters[i];
+          lanes.index_[l] = i;
+          lanes.active_[l] = true;
+          active++;
+          return;
+        }
+      }
+      // idle lanes still evaluate, on a harmless copy of a valid bracket
+      lanes.active_[l] = false;
+      lanes.done_[l] = T{1};
+    };
+
+    for (auto l = 0u; l < Lanes; l++) {
+      lanes.parameters_[l] = begin < end ? parameters[begin] : Parameter{};
+      lanes.a_[l] = begin < end ? low[begin] : T{};
+      lanes.b_[l] = lanes.a_[l] + 1;
+      lanes.fa_[l] = T{-1}, lanes.fb_[l] = T{1};
+      lanes.scale_a_[l] = lanes.scale_b_[l] = T{1};
+      load(l);
+    }
+
+    while (active > 0) {
+      // idle lanes count as finished
+      const auto finished = lanes.sweep(function, options) - (Lanes - active);
+      if (finished < std::min(active, kRefill)) continue;
+
+      for (auto l = 0u; l < Lanes; l++) {
+        if (!lanes.active_[l] || lanes.done_[l] == 0) continue;
+        finish(
+            lanes.index_[l],
+            lanes.c_[l],
+            lanes.fc_[l],
+            static_cast<std::size_t>(lanes.iterations_[l]),
+            lanes.converged_[l] != 0);
+        active--;
+        load(l);
+      }
+    }
+  });
+
+  auto res = std::size_t{0};
+  for (const auto f : failures) res += f;
+  return res;
+}
+
+}  // namespace jr_numeric::roots
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::roots {
+
+using concepts::FloatingPoint;
+
+/**
+ * @brief Stopping criteria shared by the bracketing solvers.
+ *
+ * A solver stops once the bracket is narrower than 2 * (absolute_tolerance_ + relative_tolerance_ * |x|) or once
+ * |f(x)| <= function_tolerance_.
+ */
+template <FloatingPoint T>
+struct RootOptions {
+  T absolute_tolerance_ = std::numeric_limits<T>::epsilon();
+  T relative_tolerance_ = 2 * std::numeric_limits<T>::epsilon();
+  T function_tolerance_ = 0;
+  std::size_t max_iterations_ = 100;
+};
+
+template <FloatingPoint T>
+struct RootResult {
+  T root_{};
+  T value_{};  // f(root_)
+  std::size_t iterations_{};
+  std::size_t evaluations_{};
+  bool converged_{};
+};
+
+namespace implementation {
+
+template <FloatingPoint T>
+auto tolerance(RootOptions<T> const& options, T x) noexcept -> T {
+  return options.absolute_tolerance_ + options.relative_tolerance_ * std::abs(x);
+}
+
+template <FloatingPoint T>
+auto differentSigns(T a, T b) noexcept -> bool {
+  return std::signbit(a) != std::signbit(b);
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Brent's method, inverse quadratic interpolation and secant steps safeguarded by bisection.
+ *
+ * f(low) and f(high) have to be of different signs. Falls back to bisection whenever interpolation does not shrink
+ * the bracket fast enough, converges superlinearly near simple roots of smooth functions.
+ */
+template <FloatingPoint T>
+auto brent(concepts::R1RealFunction auto const& function, T low, T high, RootOptions<T> const& options = {})
+    -> RootResult<T> {
+  auto a = low, b = high;
+  T fa = function(a), fb = function(b);
+  auto res = RootResult<T>{b, fb, 0, 2, false};
+
+  if (fa == 0) return RootResult<T>{a, fa, 0, 2, true};
+  if (fb == 0) return RootResult<T>{b, fb, 0, 2, true};
+  assert(implementation::differentSigns(fa, fb));
+
+  // b is the best estimate, c the other end of the bracket, a the previous b
+  auto c = a, fc = fa;
+  auto d = b - a, e = d;
+
+  for (; res.iterations_ < options.max_iterations_; res.iterations_++) {
+    if (!implementation::differentSigns(fb, fc)) {
+      c = a, fc = fa;
+      d = e = b - a;
+    }
+    if (std::abs(fc) < std::abs(fb)) {
+      a = b, b = c, c = a;
+      fa = fb, fb = fc, fc = fa;
+    }
+
+    const auto tol = implementation::tolerance(options, b);
+    const auto m = (c - b) / 2;
+
+    if (std::abs(m) <= tol || std::abs(fb) <= options.function_tolerance_ || fb == 0) {
+      res.converged_ = true;
+      break;
+    }
+
+    if (std::abs(e) >= tol && std::abs(fa) > std::abs(fb)) {
+      const auto s = fb / fa;
+      auto p = T{}, q = T{};
+      if (a == c) {
+        // secant
+        p = 2 * m * s;
+        q = 1 - s;
+      } else {
+        // inverse quadratic interpolation
+        const auto q0 = fa / fc;
+        const auto r = fb / fc;
+        p = s * (2 * m * q0 * (q0 - r) - (b - a) * (r - 1));
+        q = (q0 - 1) * (r - 1) * (s - 1);
+      }
+      if (p > 0)
+        q = -q;
+      else
+        p = -p;
+
+      if (2 * p < std::min(3 * m * q - std::abs(tol * q), std::abs(e * q))) {
+        e = d;
+        d = p / q;
+      } else {
+        d = e = m;
+      }
+    } else {
+      d = e = m;
+    }
+
+    a = b, fa = fb;
+    b += std::abs(d) > tol ? d : std::copysign(tol, m);
+    fb = function(b);
+    res.evaluations_++;
+  }
+
+  res.root_ = b;
+  res.value_ = fb;
+  return res;
+}
+
+/**
+ * @brief Regula falsi with the Illinois modification, the retained end point has its value halved whenever it is kept
+ * twice in a row, which gives superlinear convergence.
+ */
+template <FloatingPoint T>
+auto illinois(concepts::R1RealFunction auto const& function, T low, T high, RootOptions<T> const& options = {})
+    -> RootResult<T> {
+  auto a = low, b = high;
+  T fa = function(a), fb = function(b);
+  auto res = RootResult<T>{b, fb, 0, 2, false};
+
+  if (fa == 0) return RootResult<T>{a, fa, 0, 2, true};
+  if (fb == 0) return RootResult<T>{b, fb, 0, 2, true};
+  assert(implementation::differentSigns(fa, fb));
+
+  // every evaluation of the loop counts as an iteration, whichever test ends it
+  auto side = 0;
+  while (res.iterations_ < options.max_iterations_) {
+    const auto c = (a * fb - b * fa) / (fb - fa);
+    const T fc = function(c);
+    res.iterations_++;
+    res.evaluations_++;
+    res.root_ = c;
+    res.value_ = fc;
+
+    if (fc == 0 || std::abs(fc) <= options.function_tolerance_) {
+      res.converged_ = true;
+      break;
+    }
+
+    if (implementation::differentSigns(fc, fb)) {
+      a = c, fa = fc;
+      if (side == 1) fb /= 2;
+      side = 1;
+    } else {
+      b = c, fb = fc;
+      if (side == -1) fa /= 2;
+      side = -1;
+    }
+
+    if (std::abs(b - a) <= 2 * implementation::tolerance(options, c)) {
+      res.converged_ = true;
+      break;
+    }
+  }
+
+  return res;
+}
+
+/**
+ * @brief Interpolate, truncate and project method of Oliveira and Takahashi.
+ *
+ * Keeps the worst case of bisection (at most n0 extra evaluations) while converging superlinearly for smooth
+ * functions.
+ *
+ * @param kappa1 truncation factor, relative to the initial bracket width
+ * @param n0 slack of evaluations over bisection
+ */
+template <FloatingPoint T>
+auto itp(
+    concepts::R1RealFunction auto const& function,
+    T low,
+    T high,
+    RootOptions<T> const& options = {},
+    T kappa1 = 0.2,
+    std::size_t n0 = 1) -> RootResult<T> {
+  auto a = low, b = high;
+  T fa = function(a), fb = function(b);
+  auto res = RootResult<T>{b, fb, 0, 2, false};
+
+  if (fa == 0) return RootResult<T>{a, fa, 0, 2, true};
+  if (fb == 0) return RootResult<T>{b, fb, 0, 2, true};
+  assert(implementation::differentSigns(fa, fb));
+  assert(a < b);
+
+  const auto epsilon = implementation::tolerance(options, std::max(std::abs(a), std::abs(b)));
+  const auto k1 = kappa1 / (b - a);
+  const auto n_half = static_cast<int>(std::max(T{0}, std::ceil(std::log2((b - a) / (2 * epsilon)))));
+  const auto n_max = n_half + static_cast<int>(n0);
+
+  for (; res.iterations_ < options.max_iterations_; res.iterations_++) {
+    if (b - a <= 2 * epsilon) {
+      res.converged_ = true;
+      break;
+    }
+
+    const auto middle = (a + b) / 2;
+    const auto radius = std::ldexp(epsilon, n_max - static_cast<int>(res.iterations_)) - (b - a) / 2;
+    const auto delta = k1 * (b - a) * (b - a);
+
+    // interpolate
+    const auto regula_falsi = (fb * a - fa * b) / (fb - fa);
+
+    // truncate
+    const auto sigma = std::copysign(T{1}, middle - regula_falsi);
+    const auto truncated = delta <= std::abs(middle - regula_falsi) ? regula_falsi + sigma * delta : middle;
+
+    // project
+    const auto x = std::abs(truncated - middle) <= radius ? truncated : middle - sigma * radius;
+
+    const T fx = function(x);
+    res.evaluations_++;
+
+    if (fx == 0 || std::abs(fx) <= options.function_tolerance_) {
+      res.iterations_++;
+      res.root_ = x;
+      res.value_ = fx;
+      res.converged_ = true;
+      return res;
+    }
+
+    if (implementation::differentSigns(fx, fa))
+      b = x, fb = fx;
+    else
+      a = x, fa = fx;
+  }
+
+  const auto lower = std::abs(fa) < std::abs(fb);
+  res.root_ = lower ? a : b;
+  res.value_ = lower ? fa : fb;
+  return res;
+}
+
+}  // namespace jr_numeric::roots
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "jr_numeric/root_finding/bracketing.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+namespace jr_numeric::roots {
+
+template <FloatingPoint T>
+struct IsolationOptions {
+  std::size_t samples_ = 1024;       // uniform samples of the whole interval
+  std::size_t subdivisions_ = 8;     // samples of a suspicious interval when it is refined
+  std::size_t refinement_depth_ = 6;  // how many times a suspicious interval can be refined
+  T tangent_tolerance_ = 0;           // a local minimum with |f| below it is taken as a root of even multiplicity
+  std::size_t threads_ = utils::hardwareThreads();
+};
+
+namespace implementation {
+
+struct Isolated {
+  std::vector<std::size_t> brackets_;  // i: root between sample i and i + 1
+  std::vector<std::size_t> zeros_;     // i: f is exactly 0 at sample i
+  std::vector<std::size_t> minima_;    // i: |f| has a local minimum at sample i without a sign change around it
+};
+
+template <FloatingPoint T>
+auto classifySamples(std::vector<T> const& f) -> Isolated {
+  auto res = Isolated{};
+  for (auto i = 0u; i < f.size(); i++) {
+    if (f[i] == 0) {
+      res.zeros_.push_back(i);
+      continue;
+    }
+    if (i + 1 < f.size() && f[i + 1] != 0 && differentSigns(f[i], f[i + 1])) res.brackets_.push_back(i);
+
+    // two close roots or a root of even multiplicity hide between samples of the same sign
+    if (i > 0 && i + 1 < f.size() && !differentSigns(f[i - 1], f[i]) && !differentSigns(f[i], f[i + 1]) &&
+        f[i - 1] != 0 && f[i + 1] != 0 && std::abs(f[i]) < std::abs(f[i - 1]) && std::abs(f[i]) < std::abs(f[i + 1])) {
+      res.minima_.push_back(i);
+    }
+  }
+  return res;
+}
+
+template <FloatingPoint T>
+auto sample(T low, T high, std::size_t intervals, std::size_t i) noexcept -> T {
+  return i == intervals ? high : low + (high - low) * static_cast<T>(i) / static_cast<T>(intervals);
+}
+
+// samples a suspicious interval more densely and collects the brackets and exact roots it contains
+template <FloatingPoint T, typename Function>
+auto refine(
+    Function const& function,
+    T low,
+    T high,
+    std::size_t depth,
+    IsolationOptions<T> const& options,
+    std::vector<std::pair<T, T>>& brackets,
+    std::vector<T>& zeros) -> void {
+  const auto n = options.subdivisions_;
+  std::vector<T> f(n + 1);
+  for (auto i = 0u; i <= n; i++) f[i] = function(sample(low, high, n, i));
+
+  const auto isolated = classifySamples(f);
+  for (const auto i : isolated.zeros_) zeros.push_back(sample(low, high, n, i));
+  for (const auto i : isolated.brackets_) brackets.emplace_back(sample(low, high, n, i), sample(low, high, n, i + 1));
+  for (const auto i : isolated.minima_) {
+    if (std::abs(f[i]) <= options.tangent_tolerance_) {
+      zeros.push_back(sample(low, high, n, i));
+      continue;
+    }
+    if (depth == 0) continue;
+    refine(function, sample(low, high, n, i - 1), sample(low, high, n, i + 1), depth - 1, options, brackets, zeros);
+  }
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Brackets of every root of function on [low, high] that the sampling can see.
+ *
+ * The interval is sampled uniformly in parallel chunks. Every sign change between neighbouring samples is a bracket.
+ * Local minima of |f| without a sign change (two roots closer than the sample spacing, or a double root) are sampled
+ * again more densely, recursively. Exact zeros at samples are returned separately.
+ *
+ * @return sorted brackets and sorted exact zeros
+ */
+template <FloatingPoint T, concepts::R1RealFunction Function>
+auto isolateRoots(Function const& function, T low, T high, IsolationOptions<T> const& options = {})
+    -> std::pair<std::vector<std::pair<T, T>>, std::vector<T>> {
+  assert(low < high);
+  assert(options.samples_ >= 2 && options.subdivisions_ >= 2);
+
+  const auto n = options.samples_;
+  std::vector<T> f(n + 1);
+  utils::parallelChunks(n + 1, options.threads_, [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; i++) f[i] = function(implementation::sample(low, high, n, i));
+  });
+
+  const auto isolated = implementation::classifySamples(f);
+
+  std::vector<std::pair<T, T>> brackets;
+  std::vector<T> zeros;
+  for (const auto i : isolated.zeros_) zeros.push_back(implementation::sample(low, high, n, i));
+  for (const auto i : isolated.brackets_) {
+    brackets.emplace_back(implementation::sample(low, high, n, i), implementation::sample(low, high, n, i + 1));
+  }
+
+  // suspicious intervals are independent, each one refined by a single thread
+  const auto& minima = isolated.minima_;
+  std::vector<std::vector<std::pair<T, T>>> refined_brackets(minima.size());
+  std::vector<std::vector<T>> refined_zeros(minima.size());
+  utils::parallelFor(
+      minima.size(),
+      [&](std::size_t k) {
+        const auto i = minima[k];
+        implementation::refine(
+            function,
+            implementation::sample(low, high, n, i - 1),
+            implementation::sample(low, high, n, i + 1),
+            options.refinement_depth_,
+            options,
+            refined_brackets[k],
+            refined_zeros[k]);
+      },
+      options.threads_);
+
+  for (auto k = 0u; k < minima.size(); k++) {
+    brackets.insert(brackets.end(), refined_brackets[k].begin(), refined_brackets[k].end());
+    zeros.insert(zeros.end(), refined_zeros[k].begin(), refined_zeros[k].end());
+  }
+
+  std::ranges::sort(brackets);
+  std::ranges::sort(zeros);
+  zeros.erase(std::unique(zeros.begin(), zeros.end()), zeros.end());
+  return {std::move(brackets), std::move(zeros)};
+}
+
+/**
+ * @brief Every root of function on [low, high] visible to isolateRoots, each bracket refined by Brent's method
+ * concurrently.
+ *
+ * @return sorted roots
+ */
+template <FloatingPoint T, concepts::R1RealFunction Function>
+auto findAllRoots(
+    Function const& function,
+    T low,
+    T high,
+    IsolationOptions<T> const& isolation = {},
+    RootOptions<T> const& options = {}) -> std::vector<T> {
+  auto [brackets, roots] = isolateRoots(function, low, high, isolation);
+
+  const auto exact = roots.size();
+  roots.resize(exact + brackets.size());
+  utils::parallelFor(
+      brackets.size(),
+      [&](std::size_t i) { roots[exact + i] = brent(function, brackets[i].first, brackets[i].second, options).root_; },
+      isolation.threads_);
+
+  std::ranges::sort(roots);
+  return roots;
+}
+
+}  // namespace jr_numeric::roots
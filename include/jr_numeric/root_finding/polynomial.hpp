@@ -0,0 +1,384 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#include "jr_numeric/algebra/vectors.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+#include "jr_numeric/utils/parallel.hpp"
+
+namespace jr_numeric::roots {
+
+using concepts::FloatingPoint;
+
+struct PolynomialRootsReport {
+  std::size_t degree_{};      // number of roots written
+  std::size_t iterations_{};  // Aberth-Ehrlich sweeps
+  bool converged_{};
+  bool companion_{};  // Aberth-Ehrlich did not converge, roots are the eigenvalues of the companion matrix
+};
+
+namespace implementation {
+
+// p(z) and p'(z) by Horner's scheme, bound is the rounding error bound of p(z)
+template <FloatingPoint T>
+auto horner(std::span<const T> coefficients, std::complex<T> z, std::complex<T>& derivative, T& bound) noexcept
+    -> std::complex<T> {
+  const auto n = coefficients.size() - 1;
+  const auto modulus = std::abs(z);
+  auto p = std::complex<T>(coefficients[n]);
+  derivative = 0;
+  bound = std::abs(coefficients[n]);
+  for (auto i = n; i-- > 0;) {
+    derivative = derivative * z + p;
+    p = p * z + coefficients[i];
+    bound = bound * modulus + std::abs(coefficients[i]);
+  }
+  return p;
+}
+
+template <FloatingPoint T>
+auto aberthEhrlich(std::span<const T> coefficients, std::span<std::complex<T>> roots, std::size_t max_iterations)
+    -> PolynomialRootsReport {
+  const auto n = coefficients.size() - 1;
+  const auto epsilon = std::numeric_limits<T>::epsilon();
+  auto report = PolynomialRootsReport{n};
+
+  // starting points on a circle around the centroid of the roots, radius from the product of their moduli
+  const auto center = -coefficients[n - 1] / (static_cast<T>(n) * coefficients[n]);
+  const auto radius = std::max(std::pow(std::abs(coefficients[0] / coefficients[n]), T{1} / static_cast<T>(n)),
+                               std::sqrt(epsilon));
+  for (auto k = 0u; k < n; k++) {
+    const auto angle = 2 * std::numbers::pi_v<T> * static_cast<T>(k) / static_cast<T>(n) + T{0.4};
+    roots[k] = center + std::polar(radius, angle);
+  }
+
+  // a root is frozen once p(z) is below its rounding error or the correction is negligible
+  std::vector<bool> frozen(n);
+  auto remaining = n;
+
+  for (; report.iterations_ < max_iterations && remaining > 0; report.iterations_++) {
+    for (auto k = 0u; k < n; k++) {
+      if (frozen[k]) continue;
+
+      auto derivative = std::complex<T>{};
+      auto bound = T{};
+      const auto p = horner(coefficients, roots[k], derivative, bound);
+
+      const auto noise = std::abs(p) <= epsilon * bound;
+      if (p == T{}) {
+        frozen[k] = true;
+        remaining--;
+        continue;
+      }
+
+      const auto ratio = p / derivative;
+      auto sum = std::complex<T>{};
+      for (auto j = 0u; j < n; j++) {
+        if (j != k) sum += T{1} / (roots[k] - roots[j]);
+      }
+      const auto correction = ratio / (T{1} - ratio * sum);
+      roots[k] -= correction;
+
+      if (noise || std::abs(correction) <= epsilon * std::abs(roots[k])) {
+        frozen[k] = true;
+        remaining--;
+      }
+    }
+  }
+
+  report.converged_ = remaining == 0;
+  return report;
+}
+
+// scales rows and columns by powers of the radix to equalize their norms, keeps the Hessenberg form
+template <FloatingPoint T>
+auto balance(std::vector<T>& a, std::size_t n) noexcept -> void {
+  constexpr auto kRadix = static_cast<T>(std::numeric_limits<T>::radix);
+  auto at = [&a, n](std::size_t i, std::size_t j) -> T& { return a[i * n + j]; };
+
+  for (auto done = false; !done;) {
+    done = true;
+    for (auto i = 0u; i < n; i++) {
+      auto c = T{}, r = T{};
+      for (auto j = 0u; j < n; j++) {
+        if (j == i) continue;
+        c += std::abs(at(j, i));
+        r += std::abs(at(i, j));
+      }
+      if (c == 0 || r == 0) continue;
+
+      const auto s = c + r;
+      auto f = T{1};
+      for (auto g = r / kRadix; c < g; c *= kRadix * kRadix) f *= kRadix;
+      for (auto g = r * kRadix; c > g; c /= kRadix * kRadix) f /= kRadix;
+
+      if ((c + r) / f < T{0.95} * s) {
+        done = false;
+        for (auto j = 0u; j < n; j++) at(i, j) /= f;
+        for (auto j = 0u; j < n; j++) at(j, i) *= f;
+      }
+    }
+  }
+}
+
+// eigenvalues of an upper Hessenberg matrix by the Francis double shift QR algorithm, a is destroyed
+template <FloatingPoint T>
+auto hessenbergEigenvalues(std::vector<T>& a, std::size_t n, std::span<std::complex<T>> eigenvalues) noexcept
+    -> bool {
+  constexpr auto kMaxIterations = 60;
+  const auto epsilon = std::numeric_limits<T>::epsilon();
+  auto at = [&a, n](std::size_t i, std::size_t j) -> T& { return a[i * n + j]; };
+  auto sign = [](T magnitude, T sign) { return std::copysign(std::abs(magnitude), sign); };
+
+  auto norm = T{};
+  for (auto i = 0u; i < n; i++) {
+    for (auto j = i > 0 ? i - 1 : 0; j < n; j++) norm += std::abs(at(i, j));
+  }
+
+  auto nn = static_cast<std::ptrdiff_t>(n) - 1;
+  auto t = T{};
+  while (nn >= 0) {
+    auto iterations = 0;
+    std::ptrdiff_t l;
+    do {
+      // look for a single small subdiagonal element
+      for (l = nn; l > 0; l--) {
+        auto s = std::abs(at(l - 1, l - 1)) + std::abs(at(l, l));
+        if (s == 0) s = norm;
+        if (std::abs(at(l, l - 1)) <= epsilon * s) {
+          at(l, l - 1) = 0;
+          break;
+        }
+      }
+
+      auto x = at(nn, nn);
+      if (l == nn) {
+        // one root found
+        eigenvalues[nn--] = x + t;
+        continue;
+      }
+
+      auto y = at(nn - 1, nn - 1);
+      auto w = at(nn, nn - 1) * at(nn - 1, nn);
+      if (l == nn - 1) {
+        // two roots found
+        const auto p = (y - x) / 2;
+        const auto q = p * p + w;
+        auto z = std::sqrt(std::abs(q));
+        x += t;
+        if (q >= 0) {
+          z = p + sign(z, p);
+          eigenvalues[nn - 1] = eigenvalues[nn] = x + z;
+          if (z != 0) eigenvalues[nn] = x - w / z;
+        } else {
+          eigenvalues[nn] = std::complex<T>(x + p, -z);
+          eigenvalues[nn - 1] = std::conj(eigenvalues[nn]);
+        }
+        nn -= 2;
+        continue;
+      }
+
+      if (iterations == kMaxIterations) return false;
+      if (iterations == 10 || iterations == 20) {
+        // exceptional shift
+        t += x;
+        for (auto i = 0; i <= nn; i++) at(i, i) -= x;
+        const auto s = std::abs(at(nn, nn - 1)) + std::abs(at(nn - 1, nn - 2));
+        y = x = T{0.75} * s;
+        w = T{-0.4375} * s * s;
+      }
+      iterations++;
+
+      // look for two consecutive small subdiagonal elements
+      auto m = nn - 2;
+      auto p = T{}, q = T{}, r = T{}, z = T{};
+      for (;; m--) {
+        z = at(m, m);
+        r = x - z;
+        auto s = y - z;
+        p = (r * s - w) / at(m + 1, m) + at(m, m + 1);
+        q = at(m + 1, m + 1) - z - r - s;
+        r = at(m + 2, m + 1);
+        s = std::abs(p) + std::abs(q) + std::abs(r);
+        p /= s;
+        q /= s;
+        r /= s;
+        if (m == l) break;
+        const auto u = std::abs(at(m, m - 1)) * (std::abs(q) + std::abs(r));
+        const auto v = std::abs(p) * (std::abs(at(m - 1, m - 1)) + std::abs(z) + std::abs(at(m + 1, m + 1)));
+        if (u <= epsilon * v) break;
+      }
+
+      for (auto i = m; i < nn - 1; i++) {
+        at(i + 2, i) = 0;
+        if (i != m) at(i + 2, i - 1) = 0;
+      }
+
+      // double shift QR step on rows l to nn and columns m to nn
+      for (auto k = m; k < nn; k++) {
+        if (k != m) {
+          p = at(k, k - 1);
+          q = at(k + 1, k - 1);
+          r = k + 1 != nn ? at(k + 2, k - 1) : T{};
+          x = std::abs(p) + std::abs(q) + std::abs(r);
+          if (x != 0) {
+            p /= x;
+            q /= x;
+            r /= x;
+          }
+        }
+        const auto s = sign(std::sqrt(p * p + q * q + r * r), p);
+        if (s == 0) continue;
+
+        if (k == m) {
+          if (l != m) at(k, k - 1) = -at(k, k - 1);
+        } else {
+          at(k, k - 1) = -s * x;
+        }
+        p += s;
+        x = p / s;
+        y = q / s;
+        z = r / s;
+        q /= p;
+        r /= p;
+
+        for (auto j = k; j <= nn; j++) {
+          p = at(k, j) + q * at(k + 1, j);
+          if (k + 1 != nn) {
+            p += r * at(k + 2, j);
+            at(k + 2, j) -= p * z;
+          }
+          at(k + 1, j) -= p * y;
+          at(k, j) -= p * x;
+        }
+
+        const auto last = std::min(nn, k + 3);
+        for (auto i = l; i <= last; i++) {
+          p = x * at(i, k) + y * at(i, k + 1);
+          if (k + 1 != nn) {
+            p += z * at(i, k + 2);
+            at(i, k + 2) -= p * r;
+          }
+          at(i, k + 1) -= p * q;
+          at(i, k) -= p;
+        }
+      }
+    } while (l + 1 < nn);
+  }
+
+  return true;
+}
+
+template <FloatingPoint T>
+auto companionEigenvalues(std::span<const T> coefficients, std::span<std::complex<T>> roots) -> bool {
+  const auto n = coefficients.size() - 1;
+  std::vector<T> companion(n * n, T{});
+  for (auto j = 0u; j < n; j++) companion[j] = -coefficients[n - 1 - j] / coefficients[n];
+  for (auto i = 1u; i < n; i++) companion[i * n + i - 1] = 1;
+
+  balance(companion, n);
+  return hessenbergEigenvalues(companion, n, roots);
+}
+
+}  // namespace implementation
+
+/**
+ * @brief All complex roots of the polynomial sum(coefficients[i] * x^i), found simultaneously by the Aberth-Ehrlich
+ * iteration. Falls back to the eigenvalues of the balanced companion matrix when it does not converge.
+ *
+ * Zero leading coefficients are dropped and zero trailing coefficients give exact zero roots. The roots are written to
+ * roots, which has to hold at least coefficients.size() - 1 values; report.degree_ of them are valid.
+ */
+template <FloatingPoint T>
+auto polynomialRoots(
+    std::span<const T> coefficients, std::span<std::complex<T>> roots, std::size_t max_iterations = 100)
+    -> PolynomialRootsReport {
+  while (!coefficients.empty() && coefficients.back() == 0) coefficients = coefficients.first(coefficients.size() - 1);
+  if (coefficients.size() < 2) return PolynomialRootsReport{0, 0, true, false};
+
+  const auto n = coefficients.size() - 1;
+  assert(roots.size() >= n);
+
+  auto zeros = 0u;
+  while (coefficients[zeros] == 0) roots[zeros++] = 0;
+
+  const auto reduced = coefficients.subspan(zeros);
+  const auto rest = roots.subspan(zeros, n - zeros);
+  auto report = PolynomialRootsReport{n, 0, true, false};
+  if (reduced.size() < 2) return report;
+
+  if (reduced.size() == 2) {
+    rest[0] = -reduced[0] / reduced[1];
+    return report;
+  }
+
+  const auto aberth = implementation::aberthEhrlich(reduced, rest, max_iterations);
+  report.iterations_ = aberth.iterations_;
+  if (!aberth.converged_) {
+    report.companion_ = true;
+    report.converged_ = implementation::companionEigenvalues(reduced, rest);
+  }
+
+  return report;
+}
+
+/**
+ * @brief roots of a polynomial given by its coefficients, ascending powers
+ */
+template <FloatingPoint T>
+auto polynomialRoots(std::span<const T> coefficients) -> std::vector<std::complex<T>> {
+  std::vector<std::complex<T>> roots(coefficients.empty() ? 0 : coefficients.size() - 1);
+  const auto report = polynomialRoots(coefficients, std::span<std::complex<T>>(roots));
+  roots.resize(report.degree_);
+  return roots;
+}
+
+template <std::size_t N, FloatingPoint T>
+auto polynomialRoots(algebra::Polynomial<N, T> const& polynomial) -> std::vector<std::complex<T>> {
+  std::array<T, N> coefficients;
+  for (auto i = 0u; i < N; i++) coefficients[i] = polynomial.coefficient(i);
+  return polynomialRoots(std::span<const T>(coefficients));
+}
+
+/**
+ * @brief Roots of many polynomials of the same size, e.g. characteristic polynomials, spread over threads.
+ *
+ * Roots of a polynomial of lower degree than N - 1 are padded with NaN.
+ *
+ * @return number of polynomials that did not converge
+ */
+template <std::size_t N, FloatingPoint T>
+  requires(N >= 2)
+auto polynomialRoots(
+    std::span<const algebra::Polynomial<N, T>> polynomials,
+    std::span<std::array<std::complex<T>, N - 1>> roots,
+    std::size_t threads = utils::hardwareThreads()) -> std::size_t {
+  assert(roots.size() >= polynomials.size());
+  std::vector<std::size_t> failures(std::max<std::size_t>(threads, 1), 0);
+
+  utils::parallelChunks(polynomials.size(), threads, [&](std::size_t id, std::size_t begin, std::size_t end) {
+    std::array<T, N> coefficients;
+    for (auto p = begin; p < end; p++) {
+      for (auto i = 0u; i < N; i++) coefficients[i] = polynomials[p].coefficient(i);
+
+      roots[p].fill(std::numeric_limits<T>::quiet_NaN());
+      const auto report = polynomialRoots(std::span<const T>(coefficients), std::span<std::complex<T>>(roots[p]));
+      if (!report.converged_) failures[id]++;
+    }
+  });
+
+  auto res = std::size_t{0};
+  for (const auto f : failures) res += f;
+  return res;
+}
+
+}  // namespace jr_numeric::roots
@@ -39,6 +39,7 @@ template <concepts::FloatingPoint T>
 auto newtonRaphson(concepts::R1RealFunction auto const& function, T x_0, std::uint64_t n) -> T {
   for (auto i = 0u; i < n; i++) {
     auto dfdx = derivative(function, x_0);
+    if (dfdx == 0) break;  // flat, the step would leave to infinity
     auto f_x = function(x_0);
     x_0 = (dfdx * x_0 - f_x) / dfdx;
   }
@@ -46,4 +47,18 @@ auto newtonRaphson(concepts::R1RealFunction auto const& function, T x_0, std::ui
   return x_0;
 }
 
+/**
+ * @brief takes the value and the exact derivative from a single evaluation of function with a Dual number
+ */
+template <concepts::FloatingPoint T, differential::DualR1Function<T> Function>
+auto newtonRaphson(Function const& function, T x_0, std::uint64_t n) -> T {
+  for (auto i = 0u; i < n; i++) {
+    auto f_x = function(differential::Dual<T, 1>::variable(x_0, 0));
+    if (f_x.gradient_[0] == 0) break;
+    x_0 -= f_x.value_ / f_x.gradient_[0];
+  }
+
+  return x_0;
+}
+
 }  // namespace jr_numeric::roots
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "jr_numeric/algebra/lu.hpp"
+#include "jr_numeric/algebra/matrix.hpp"
+#include "jr_numeric/differential/gradient.hpp"
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::roots {
+
+using concepts::FloatingPoint;
+
+enum class SystemMethod {
+  KNewton,   // forward difference jacobian, factorized once and reused while the residual keeps dropping
+  KBroyden,  // one jacobian at the start, then rank-1 updates of its inverse, no extra evaluations per iteration
+};
+
+/**
+ * @brief F: R^N -> R^N taking either N arguments of type T (as ScalarField) or a single std::array<T, N>
+ */
+template <typename Function, typename T, std::size_t N>
+concept VectorField = std::is_invocable_r_v<std::array<T, N>, Function const&, std::array<T, N> const&> ||
+                      (differential::InvocableWith<Function, T, N> &&
+                       std::is_convertible_v<
+                           decltype(std::apply(std::declval<Function const&>(), std::array<T, N>{})),
+                           std::array<T, N>>);
+
+template <FloatingPoint T>
+struct SystemOptions {
+  T residual_tolerance_ = std::sqrt(std::numeric_limits<T>::epsilon());  // on ||F(x)||
+  T step_tolerance_ = 4 * std::numeric_limits<T>::epsilon();              // on ||dx|| / (1 + ||x||)
+  std::size_t max_iterations_ = 100;
+  std::size_t jacobian_reuse_ = 4;  // newton: maximum number of iterations one factorization serves
+};
+
+template <FloatingPoint T, std::size_t N>
+struct SystemResult {
+  std::array<T, N> x_{};
+  std::array<T, N> residual_{};
+  T residual_norm_{};
+  std::size_t iterations_{};
+  std::size_t evaluations_{};
+  std::size_t jacobians_{};
+  bool converged_{};
+};
+
+namespace implementation {
+
+template <FloatingPoint T, std::size_t N, typename Function>
+auto evaluate(Function const& function, std::array<T, N> const& x) -> std::array<T, N> {
+  if constexpr (std::is_invocable_v<Function const&, std::array<T, N> const&>)
+    return function(x);
+  else
+    return std::apply(function, x);
+}
+
+template <FloatingPoint T, std::size_t N>
+auto norm(std::array<T, N> const& v) noexcept -> T {
+  auto sum = T{};
+  for (const auto e : v) sum += e * e;
+  return std::sqrt(sum);
+}
+
+// forward differences reusing F(x), N evaluations
+template <FloatingPoint T, std::size_t N, typename Function>
+auto forwardJacobian(Function const& function, std::array<T, N> x, std::array<T, N> const& f_x)
+    -> algebra::Matrix<N, N, T> {
+  algebra::Matrix<N, N, T> res;
+  for (auto j = 0u; j < N; j++) {
+    const auto original = x[j];
+    x[j] += differential::implementation::forwardStep(original);
+    const auto h = x[j] - original;
+    const auto f_h = evaluate(function, x);
+    for (auto i = 0u; i < N; i++) res[i][j] = (f_h[i] - f_x[i]) / h;
+    x[j] = original;
+  }
+  return res;
+}
+
+template <FloatingPoint T, std::size_t N>
+auto inverse(algebra::LuFactorization<N, T> const& lu) -> algebra::Matrix<N, N, T> {
+  algebra::Matrix<N, N, T> res;
+  std::array<T, N> unit{};
+  for (auto j = 0u; j < N; j++) {
+    unit[j] = 1;
+    const auto column = algebra::luSolve(lu, unit);
+    for (auto i = 0u; i < N; i++) res[i][j] = column[i];
+    unit[j] = 0;
+  }
+  return res;
+}
+
+}  // namespace implementation
+
+/**
+ * @brief Solves F(x) = 0 for F: R^N -> R^N with a damped Newton or Broyden iteration.
+ *
+ * Every step is damped by a backtracking line search on ||F||^2. A Newton iteration costs O(N^2) and one
+ * evaluation (plus the line search) as long as the factorized jacobian is reused, a fresh jacobian costs N
+ * evaluations and O(N^3). Broyden keeps J^-1 and updates it with a rank-1 correction per iteration, O(N^2). A stale
+ * jacobian that does not give a descent direction is recomputed before giving up.
+ */
+template <SystemMethod Method = SystemMethod::KNewton, FloatingPoint T, std::size_t N, VectorField<T, N> Function>
+auto solveSystem(Function const& function, std::array<T, N> x, SystemOptions<T> const& options = {})
+    -> SystemResult<T, N> {
+  constexpr auto kArmijo = T{1e-4};
+  constexpr auto kMinDamping = T{1e-10};
+
+  auto res = SystemResult<T, N>{};
+  auto f_x = implementation::evaluate(function, x);
+  auto f_norm = implementation::norm(f_x);
+  res.evaluations_ = 1;
+
+  // newton keeps the factorization, broyden the inverse
+  algebra::LuFactorization<N, T> lu;
+  algebra::Matrix<N, N, T> inverse;
+  auto age = std::size_t{0};
+  auto fresh = false;
+
+  auto refresh = [&] {
+    lu = algebra::luFactorize(implementation::forwardJacobian(function, x, f_x));
+    if constexpr (Method == SystemMethod::KBroyden) inverse = implementation::inverse(lu);
+    res.evaluations_ += N;
+    res.jacobians_++;
+    age = 0;
+    fresh = true;
+  };
+
+  refresh();
+
+  std::array<T, N> dx;
+  std::array<T, N> x_new;
+  std::array<T, N> f_new;
+
+  for (; res.iterations_ < options.max_iterations_; res.iterations_++) {
+    if (f_norm <= options.residual_tolerance_) {
+      res.converged_ = true;
+      break;
+    }
+
+    if constexpr (Method == SystemMethod::KNewton) {
+      dx = algebra::luSolve(lu, f_x);
+    } else {
+      for (auto i = 0u; i < N; i++) {
+        dx[i] = T{};
+        for (auto j = 0u; j < N; j++) dx[i] += inverse[i][j] * f_x[j];
+      }
+    }
+    for (auto& e : dx) e = -e;
+
+    // backtracking on ||F||^2 with quadratic interpolation of the damping
+    auto damping = T{1};
+    auto f_new_norm = T{};
+    auto accepted = false;
+    if (!lu.singular_) {
+      while (damping >= kMinDamping) {
+        for (auto i = 0u; i < N; i++) x_new[i] = x[i] + damping * dx[i];
+        f_new = implementation::evaluate(function, x_new);
+        f_new_norm = implementation::norm(f_new);
+        res.evaluations_++;
+
+        if (f_new_norm * f_new_norm <= (1 - 2 * kArmijo * damping) * f_norm * f_norm) {
+          accepted = true;
+          break;
+        }
+
+        // minimum of the parabola through phi(0) = ||F||^2, phi'(0) = -2 ||F||^2 and phi(damping)
+        const auto phi0 = f_norm * f_norm;
+        const auto curvature = f_new_norm * f_new_norm - phi0 + 2 * phi0 * damping;
+        const auto minimum = phi0 * damping * damping / curvature;
+        damping = std::clamp(minimum, T{0.1} * damping, T{0.5} * damping);
+      }
+    }
+
+    if (!accepted) {
+      if (fresh) break;
+      refresh();
+      continue;
+    }
+
+    if constexpr (Method == SystemMethod::KBroyden) {
+      // good Broyden update of the inverse, H += (s - H y) s^T H / (s^T H y)
+      std::array<T, N> s, y, h_y, s_h;
+      for (auto i = 0u; i < N; i++) {
+        s[i] = damping * dx[i];
+        y[i] = f_new[i] - f_x[i];
+      }
+      auto denominator = T{};
+      for (auto i = 0u; i < N; i++) {
+        h_y[i] = s_h[i] = T{};
+        for (auto j = 0u; j < N; j++) {
+          h_y[i] += inverse[i][j] * y[j];
+          s_h[i] += s[j] * inverse[j][i];
+        }
+      }
+      for (auto i = 0u; i < N; i++) denominator += s[i] * h_y[i];
+
+      if (std::abs(denominator) > std::numeric_limits<T>::min()) {
+        for (auto i = 0u; i < N; i++) {
+          const auto factor = (s[i] - h_y[i]) / denominator;
+          for (auto j = 0u; j < N; j++) inverse[i][j] += factor * s_h[j];
+        }
+      }
+    }
+
+    const auto step_norm = damping * implementation::norm(dx);
+    const auto reduction = f_new_norm / f_norm;
+
+    x = x_new;
+    f_x = f_new;
+    f_norm = f_new_norm;
+    fresh = false;
+
+    if (step_norm <= options.step_tolerance_ * (1 + implementation::norm(x))) {
+      res.iterations_++;
+      // a short step from heavy damping is stagnation, only a short full step counts
+      res.converged_ = f_norm <= options.residual_tolerance_ ||
+                       implementation::norm(dx) <= options.step_tolerance_ * (1 + implementation::norm(x));
+      break;
+    }
+
+    if constexpr (Method == SystemMethod::KNewton) {
+      // slow progress means the linearization is too old
+      const auto stale = ++age >= options.jacobian_reuse_ || reduction > T{0.5};
+      if (stale && f_norm > options.residual_tolerance_) refresh();
+    }
+  }
+
+  res.x_ = x;
+  res.residual_ = f_x;
+  res.residual_norm_ = f_norm;
+  return res;
+}
+
+}  // namespace jr_numeric::roots
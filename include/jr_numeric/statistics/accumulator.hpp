@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <ranges>
+
+#include "jr_numeric/utils/concepts.hpp"
+
+namespace jr_numeric::statistics {
+
+using concepts::FloatingPoint;
+
+/**
+ * @brief Count, mean and sum of squared deviations of a stream in a single pass and O(1) memory.
+ *
+ * push is Welford's update. merge is the pairwise formula of Chan, Golub and LeVeque, so partial results of threads or
+ * files combine into the same moments as one pass over all the data. A range is pushed in blocks: every block is
+ * reduced with two cache resident passes, which vectorize, and then merged.
+ */
+template <FloatingPoint T>
+struct Accumulator {
+  static constexpr std::size_t kBlock = 256;
+
+  std::size_t count_{};
+  T mean_{};
+  T m2_{};
+
+  auto push(T x) noexcept -> void {
+    count_++;
+    const auto delta = x - mean_;
+    mean_ += delta / static_cast<T>(count_);
+    m2_ += delta * (x - mean_);
+  }
+
+  template <std::ranges::input_range Range>
+  auto push(Range const& samples) -> void {
+    std::array<T, kBlock> block;
+    auto size = std::size_t{0};
+    for (const auto x : samples) {
+      block[size++] = static_cast<T>(x);
+      if (size == kBlock) {
+        pushBlock(block, size);
+        size = 0;
+      }
+    }
+    pushBlock(block, size);
+  }
+
+  auto merge(Accumulator const& other) noexcept -> void {
+    if (other.count_ == 0) return;
+    const auto count = count_ + other.count_;
+    const auto delta = other.mean_ - mean_;
+    mean_ += delta * static_cast<T>(other.count_) / static_cast<T>(count);
+    m2_ += other.m2_ + delta * delta * static_cast<T>(count_) * static_cast<T>(other.count_) / static_cast<T>(count);
+    count_ = count;
+  }
+
+  /**
+   * @brief sample variance, with n - 1 in the denominator
+   */
+  [[nodiscard]] auto variance() const noexcept -> T {
+    assert(count_ > 1);
+    return m2_ / static_cast<T>(count_ - 1);
+  }
+
+ private:
+  auto pushBlock(std::array<T, kBlock> const& block, std::size_t size) noexcept -> void {
+    if (size == 0) return;
+
+    auto sum = T{};
+    for (auto i = 0u; i < size; i++) sum += block[i];
+    const auto mean = sum / static_cast<T>(size);
+
+    auto m2 = T{};
+    for (auto i = 0u; i < size; i++) m2 += (block[i] - mean) * (block[i] - mean);
+
+    merge(Accumulator{size, mean, m2});
+  }
+};
+
+}  // namespace jr_numeric::statistics
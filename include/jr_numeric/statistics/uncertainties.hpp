@@ -5,6 +5,7 @@
 #include <fmt/printf.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <concepts>
@@ -12,9 +13,11 @@
 #include <fstream>
 #include <functional>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "jr_numeric/differential/derivatives.hpp"
+#include "jr_numeric/differential/reverse.hpp"
 #include "jr_numeric/statistics/utils.hpp"
 #include "jr_numeric/utils/concepts.hpp"
 
@@ -22,18 +25,15 @@ namespace jr_numeric::statistics {
 
 namespace implementation {
 
-template <
-    std::size_t I = 0,
-    FloatingPoint T,
-    std::same_as<Quantity<T>>... Quantities,
-    ScalarField<sizeof...(Quantities)> Function>
+template <FloatingPoint T, std::same_as<Quantity<T>>... Quantities, ScalarField<sizeof...(Quantities)> Function>
 auto addUncertainties(T& uncertainties_combined, Function const& function, Quantities const&... quantities) -> void {
-  if constexpr (I < sizeof...(Quantities)) {
-    auto uncertainties_sq = std::make_tuple(quantities.uncertainty_sq_...);
-    uncertainties_combined +=
-        std::pow(differential::partialDerivative<I>(function, quantities.value_...), 2) * std::get<I>(uncertainties_sq);
-    addUncertainties<I + 1>(uncertainties_combined, function, quantities...);
-  }
+  const std::array<T, sizeof...(Quantities)> uncertainties_sq{quantities.uncertainty_sq_...};
+
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    ((uncertainties_combined +=
+      std::pow(differential::partialDerivative<I>(function, quantities.value_...), 2) * uncertainties_sq[I]),
+     ...);
+  }(std::index_sequence_for<Quantities...>{});
 }
 
 }  // namespace implementation
@@ -54,5 +54,30 @@ auto combineQuantities(Function const& function, Quantities const&... quantities
   };
 }
 
+/**
+ * @brief Variant for callables generic over the number type (see differential::Var).
+ *
+ * The whole gradient costs one forward and one backward pass on a thread local tape, instead of two evaluations of
+ * function per quantity.
+ */
+template <
+    FloatingPoint T,
+    std::same_as<Quantity<T>>... Quantities,
+    differential::ReverseScalarField<T, sizeof...(Quantities)> Function>
+auto combineQuantities(Function const& function, Quantities const&... quantities) -> Quantity<T> {
+  const auto [value, gradient] = differential::reverseGradient<T>(function, quantities.value_...);
+  const std::array<T, sizeof...(Quantities)> uncertainties_sq{quantities.uncertainty_sq_...};
+
+  auto uncertainties_combined_sq = T{};
+  for (auto i = 0u; i < gradient.size(); i++) {
+    uncertainties_combined_sq += gradient[i] * gradient[i] * uncertainties_sq[i];
+  }
+
+  return Quantity{
+      value,
+      uncertainties_combined_sq,
+  };
+}
+
 }  // namespace jr_numeric::statistics
 
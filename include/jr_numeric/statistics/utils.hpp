@@ -8,6 +8,7 @@
 #include <numeric>
 #include <vector>
 
+#include "jr_numeric/statistics/accumulator.hpp"
 #include "jr_numeric/utils/concepts.hpp"
 
 namespace jr_numeric::statistics {
@@ -65,7 +66,7 @@ template <FloatingPoint T, ReadOnlyRange<T> Range>
 auto calculateSampleStdDeviationSq(Range const& samples, T mean) -> T {
   assert(samples.size() > 1);
   auto res = std::transform_reduce(
-      samples.begin(), samples.end(), T{}, std::plus<>{}, [mean](auto const x) { return std::pow(x - mean, 2); });
+      samples.begin(), samples.end(), T{}, std::plus<>{}, [mean](auto const x) { return (x - mean) * (x - mean); });
   return res / (samples.size() - 1);
 }
 
@@ -79,22 +80,31 @@ auto calcualteGeneralizedUncertaintySq(T std_uncertainty_of_mean_sq, T uncertain
   return std_uncertainty_of_mean_sq + std::pow(uncertainty_of_device, 2) / 3;
 }
 
-template <FloatingPoint T, ReadOnlyRange<T> Range>
-auto setupMeasurement(Range const& samples, T uncertainty_of_device) -> Measurement<T> {
-  auto mean = calculateMean<T>(samples);
-  auto variance = calculateSampleStdDeviationSq(samples, mean);
-  auto std_uncertainty_of_mean_sq = calculateStdUncertaintyOfMeanSq(variance, samples.size());
+/**
+ * @brief Measurement from moments accumulated in a single pass, e.g. merged from threads or files
+ */
+template <FloatingPoint T>
+auto setupMeasurement(Accumulator<T> const& moments, T uncertainty_of_device) -> Measurement<T> {
+  auto variance = moments.variance();
+  auto std_uncertainty_of_mean_sq = calculateStdUncertaintyOfMeanSq(variance, moments.count_);
   auto generalized_uncertainty_sq =
       calcualteGeneralizedUncertaintySq(std_uncertainty_of_mean_sq, uncertainty_of_device);
 
   return Measurement{
-      mean,
+      moments.mean_,
       variance,
       std_uncertainty_of_mean_sq,
       generalized_uncertainty_sq,
   };
 }
 
+template <FloatingPoint T, ReadOnlyRange<T> Range>
+auto setupMeasurement(Range const& samples, T uncertainty_of_device) -> Measurement<T> {
+  auto moments = Accumulator<T>{};
+  moments.push(samples);
+  return setupMeasurement(moments, uncertainty_of_device);
+}
+
 template <FloatingPoint T, ReadOnlyRange<Quantity<T>> Range>
 auto meanQuantity(Range const& quantities) -> Quantity<T> {
   auto mean = T{};
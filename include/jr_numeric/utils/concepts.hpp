@@ -40,6 +40,17 @@ struct FunctionArgs<auto(ClassType::*)(Ts...) const->Ret> {
   using args = std::tuple<Ts...>;
 };
 
+// noexcept is part of the type, e.g. call operators of interpolants
+template <ClassType ClassType, typename Ret, typename... Ts>
+struct FunctionArgs<Ret (ClassType::*)(Ts...) noexcept> {
+  using args = std::tuple<Ts...>;
+};
+
+template <ClassType ClassType, typename Ret, typename... Ts>
+struct FunctionArgs<auto(ClassType::*)(Ts...) const noexcept->Ret> {
+  using args = std::tuple<Ts...>;
+};
+
 template <typename Functor>
   requires HasCallableOperator<Functor>
 struct FunctionArgs<Functor> {
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace jr_numeric::utils {
+
+inline auto hardwareThreads() noexcept -> std::size_t {
+  return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Splits [0, n) into at most threads contiguous chunks and runs function(chunk_id, begin, end) for each chunk
+ * on its own thread. The calling thread handles the first chunk.
+ *
+ * @param n number of work items
+ * @param threads upper bound of threads to use
+ * @param function callable invoked concurrently, must not share mutable state between chunks
+ * @return number of chunks the range was split into
+ */
+template <typename Function>
+auto parallelChunks(std::size_t n, std::size_t threads, Function const& function) -> std::size_t {
+  threads = std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(n, 1));
+
+  auto const chunk = n / threads;
+  auto const remainder = n % threads;
+
+  auto chunk_begin = [chunk, remainder](std::size_t id) { return id * chunk + std::min(id, remainder); };
+
+  std::vector<std::jthread> workers;
+  workers.reserve(threads - 1);
+
+  for (auto id = 1u; id < threads; id++) {
+    workers.emplace_back([&function, &chunk_begin, id] { function(id, chunk_begin(id), chunk_begin(id + 1)); });
+  }
+
+  function(std::size_t{0}, chunk_begin(0), chunk_begin(1));
+
+  return threads;
+}
+
+/**
+ * @brief Runs function(i) for every i in [0, n), spread over threads
+ */
+template <typename Function>
+auto parallelFor(std::size_t n, Function const& function, std::size_t threads = hardwareThreads()) -> void {
+  parallelChunks(n, threads, [&function](std::size_t, std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; i++) function(i);
+  });
+}
+
+}  // namespace jr_numeric::utils